@@ -1,6 +1,13 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "ManipulatorComponent.h"
+#include "ManipulatorPreset.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/SkeletalMeshSocket.h"
+#include "Engine/StaticMeshSocket.h"
+#include "UObject/UnrealType.h"
 
 // Sets default values for this component's properties
 UManipulatorComponent::UManipulatorComponent()
@@ -17,52 +24,139 @@ UManipulatorComponent::UManipulatorComponent()
 }
 
 
+namespace
+{
+	/** Lane by lane FMath::Clamp, values below Min snap to Min and everything else is capped at Max. */
+	FORCEINLINE VectorRegister VectorClampLikeScalar(const VectorRegister& Value, const VectorRegister& Min, const VectorRegister& Max)
+	{
+		return VectorSelect(VectorCompareGT(Min, Value), Min, VectorMin(Value, Max));
+	}
+
+	/** Starts overriding part of the preset, seeded with the preset's value so an edit lands on top of what was being drawn. */
+	template<typename T>
+	void OverridePresetValue(bool& bOverride, T& Value, const T* PresetValue)
+	{
+		if (bOverride == false)
+		{
+			if (PresetValue != nullptr)
+			{
+				Value = *PresetValue;
+			}
+			bOverride = true;
+		}
+	}
+}
+
 FTransform UManipulatorComponent::ConstrainTransform(FTransform Transform)
 {
-	if (Settings.Property.Type == EManipulatorPropertyType::MT_TRANSFORM || Settings.Property.Type == EManipulatorPropertyType::MT_VECTOR)
+	ConstrainTransformsInPlace(MakeArrayView(&Transform, 1));
+	return Transform;
+}
+
+TArray<FTransform> UManipulatorComponent::ConstrainTransforms(TArray<FTransform> Transforms)
+{
+	ConstrainTransformsInPlace(Transforms);
+	return Transforms;
+}
+
+void UManipulatorComponent::ConstrainTransformsInPlace(TArrayView<FTransform> Transforms) const
+{
+#if ENABLE_VECTORIZED_TRANSFORM
+	if (Settings.Property.Type != EManipulatorPropertyType::MT_TRANSFORM && Settings.Property.Type != EManipulatorPropertyType::MT_VECTOR)
+	{
+		return;
+	}
+
+	const FManipulatorSettingsMainConstraints& Constraints = GetConstraintSettings();
+	if (Constraints.UseLocationConstraint == false && Constraints.UseScaleConstraint == false)
 	{
-		if (Settings.Constraints.UseLocationConstraint)
+		return;
+	}
+
+	// Translation is clamped on the transform's own register, scale only has an FVector accessor so it goes through a register load and store.
+	// Bounds are loaded with W at 0 which leaves W untouched.
+	const FVector LocationMin(Constraints.XLocationMinMax.X, Constraints.YLocationMinMax.X, Constraints.ZLocationMinMax.X);
+	const FVector LocationMax(Constraints.XLocationMinMax.Y, Constraints.YLocationMinMax.Y, Constraints.ZLocationMinMax.Y);
+	const FVector ScaleMin(Constraints.XScaleMinMax.X, Constraints.YScaleMinMax.X, Constraints.ZScaleMinMax.X);
+	const FVector ScaleMax(Constraints.XScaleMinMax.Y, Constraints.YScaleMinMax.Y, Constraints.ZScaleMinMax.Y);
+	const VectorRegister LocationMinRegister = VectorLoadFloat3_W0(&LocationMin);
+	const VectorRegister LocationMaxRegister = VectorLoadFloat3_W0(&LocationMax);
+	const VectorRegister ScaleMinRegister = VectorLoadFloat3_W0(&ScaleMin);
+	const VectorRegister ScaleMaxRegister = VectorLoadFloat3_W0(&ScaleMax);
+
+	for (FTransform& Transform : Transforms)
+	{
+		if (Constraints.UseLocationConstraint)
+		{
+			Transform.SetTranslationRegister(VectorClampLikeScalar(Transform.GetTranslationRegister(), LocationMinRegister, LocationMaxRegister));
+		}
+		if (Constraints.UseScaleConstraint)
 		{
-			// Constrain Location.
-			FVector Location = Transform.GetLocation();
-			Location.X = FMath::Clamp(Location.X, Settings.Constraints.XLocationMinMax.X, Settings.Constraints.XLocationMinMax.Y);
-			Location.Y = FMath::Clamp(Location.Y, Settings.Constraints.YLocationMinMax.X, Settings.Constraints.YLocationMinMax.Y);
-			Location.Z = FMath::Clamp(Location.Z, Settings.Constraints.ZLocationMinMax.X, Settings.Constraints.ZLocationMinMax.Y);
-			Transform.SetLocation(Location);
+			const FVector Scale = Transform.GetScale3D();
+			FVector ClampedScale;
+			VectorStoreFloat3(VectorClampLikeScalar(VectorLoadFloat3_W0(&Scale), ScaleMinRegister, ScaleMaxRegister), &ClampedScale);
+			Transform.SetScale3D(ClampedScale);
 		}
+	}
+#else
+	ConstrainTransformsInPlaceScalar(Transforms);
+#endif
+}
 
-		if (Settings.Constraints.UseScaleConstraint)
+void UManipulatorComponent::ConstrainTransformsInPlaceScalar(TArrayView<FTransform> Transforms) const
+{
+	if (Settings.Property.Type != EManipulatorPropertyType::MT_TRANSFORM && Settings.Property.Type != EManipulatorPropertyType::MT_VECTOR)
+	{
+		return;
+	}
+
+	const FManipulatorSettingsMainConstraints& Constraints = GetConstraintSettings();
+	for (FTransform& Transform : Transforms)
+	{
+		if (Constraints.UseLocationConstraint)
 		{
-			FVector Scale = Transform.GetScale3D();
-			Scale.X = FMath::Clamp(Scale.X, Settings.Constraints.XScaleMinMax.X, Settings.Constraints.XScaleMinMax.Y);
-			Scale.Y = FMath::Clamp(Scale.Y, Settings.Constraints.YScaleMinMax.X, Settings.Constraints.YScaleMinMax.Y);
-			Scale.Z = FMath::Clamp(Scale.Z, Settings.Constraints.ZScaleMinMax.X, Settings.Constraints.ZScaleMinMax.Y);
-			Transform.SetScale3D(Scale);
+			const FVector Location = Transform.GetLocation();
+			Transform.SetLocation(FVector(
+				FMath::Clamp(Location.X, Constraints.XLocationMinMax.X, Constraints.XLocationMinMax.Y),
+				FMath::Clamp(Location.Y, Constraints.YLocationMinMax.X, Constraints.YLocationMinMax.Y),
+				FMath::Clamp(Location.Z, Constraints.ZLocationMinMax.X, Constraints.ZLocationMinMax.Y)));
+		}
+		if (Constraints.UseScaleConstraint)
+		{
+			const FVector Scale = Transform.GetScale3D();
+			Transform.SetScale3D(FVector(
+				FMath::Clamp(Scale.X, Constraints.XScaleMinMax.X, Constraints.XScaleMinMax.Y),
+				FMath::Clamp(Scale.Y, Constraints.YScaleMinMax.X, Constraints.YScaleMinMax.Y),
+				FMath::Clamp(Scale.Z, Constraints.ZScaleMinMax.X, Constraints.ZScaleMinMax.Y)));
 		}
 	}
-	return Transform;
 }
 
 void UManipulatorComponent::SetColors(FLinearColor Color, FLinearColor SelectedColor)
 {
+	PresetOverrides.bOverride_Colors = true;
 	Settings.Draw.BaseColor = Color;
 	Settings.Draw.SelectedColor = SelectedColor;
+	NotifySettingsChanged();
 }
 
 void UManipulatorComponent::SetManipulatorVisualOffset(FTransform ManipulatorVisualOffset, int32 Index)
 {
+	OverridePresetValue(PresetOverrides.bOverride_Offsets, Settings.Draw.Offsets, Preset ? &Preset->Draw.Offsets : nullptr);
 	SetArrayElement(ManipulatorVisualOffset, Settings.Draw.Offsets, Index);
+	NotifySettingsChanged();
 }
 
 FTransform UManipulatorComponent::GetVisualOffset(int32 Index, bool OutputCombinedOffsets)
 {
+	const TArray<FTransform>& Offsets = GetDrawSettings().Offsets;
 	if (OutputCombinedOffsets == true)
 	{
-		return CombineOffsetTransforms(Settings.Draw.Offsets);
+		return CombineOffsetTransforms(Offsets);
 	}
-	else if(Settings.Draw.Offsets.IsValidIndex(Index))
+	else if(Offsets.IsValidIndex(Index))
 	{
-		return Settings.Draw.Offsets[Index];
+		return Offsets[Index];
 	}
 
 	return FTransform();
@@ -70,7 +164,168 @@ FTransform UManipulatorComponent::GetVisualOffset(int32 Index, bool OutputCombin
 
 void UManipulatorComponent::ClearVisualOffsets()
 {
+	PresetOverrides.bOverride_Offsets = true;
 	Settings.Draw.Offsets.Empty();
+	NotifySettingsChanged();
+}
+
+void UManipulatorComponent::SetManipulatorVisualOffsets(TArray<FTransform> ManipulatorVisualOffsets, int32 StartIndex)
+{
+	OverridePresetValue(PresetOverrides.bOverride_Offsets, Settings.Draw.Offsets, Preset ? &Preset->Draw.Offsets : nullptr);
+	SetArrayElements(MoveTemp(ManipulatorVisualOffsets), Settings.Draw.Offsets, FMath::Max(StartIndex, 0));
+	NotifySettingsChanged();
+}
+
+void UManipulatorComponent::ApplySettings(FManipulatorSettingsMain NewSettings, bool ApplyProperty, bool ApplyDraw, bool ApplyConstraints)
+{
+	if (ApplyProperty)
+	{
+		Settings.Property = MoveTemp(NewSettings.Property);
+	}
+	if (ApplyDraw)
+	{
+		Settings.Draw = MoveTemp(NewSettings.Draw);
+		PresetOverrides.bOverride_Colors = true;
+		PresetOverrides.bOverride_OverallSize = true;
+		PresetOverrides.bOverride_Offsets = true;
+		PresetOverrides.bOverride_Shapes = true;
+		PresetOverrides.bOverride_Extras = true;
+	}
+	if (ApplyConstraints)
+	{
+		Settings.Constraints = MoveTemp(NewSettings.Constraints);
+		PresetOverrides.bOverride_Constraints = true;
+	}
+	NotifySettingsChanged();
+}
+
+void UManipulatorComponent::NotifySettingsChanged()
+{
+	SettingsVersion++;
+	OnSettingsChanged.Broadcast(this);
+}
+
+uint32 UManipulatorComponent::GetSettingsVersion() const
+{
+	// Swapping or editing the preset counts as a settings change on every manipulator using it, folded in here so nothing has to be written to find out.
+	const uint32 PresetVersion = IsValid(Preset) ? Preset->GetPresetVersion() : 0;
+	return HashCombine(SettingsVersion, HashCombine(GetTypeHash(Preset), PresetVersion));
+}
+
+const FManipulatorSettingsMainDraw& UManipulatorComponent::GetDrawSettings() const
+{
+	if (IsValid(Preset) == false || PresetOverrides.AllDrawOverridden())
+	{
+		return Settings.Draw;
+	}
+	if (PresetOverrides.AnyDrawOverridden() == false)
+	{
+		return Preset->Draw;
+	}
+
+	const uint32 Version = GetSettingsVersion();
+	if (ResolvedDrawVersion != Version)
+	{
+		ResolvedDraw = Preset->Draw;
+		if (PresetOverrides.bOverride_Colors)
+		{
+			ResolvedDraw.BaseColor = Settings.Draw.BaseColor;
+			ResolvedDraw.SelectedColor = Settings.Draw.SelectedColor;
+		}
+		if (PresetOverrides.bOverride_OverallSize)
+		{
+			ResolvedDraw.OverallSize = Settings.Draw.OverallSize;
+		}
+		if (PresetOverrides.bOverride_Offsets)
+		{
+			ResolvedDraw.Offsets = Settings.Draw.Offsets;
+		}
+		if (PresetOverrides.bOverride_Shapes)
+		{
+			ResolvedDraw.Shapes = Settings.Draw.Shapes;
+		}
+		if (PresetOverrides.bOverride_Extras)
+		{
+			ResolvedDraw.Extras = Settings.Draw.Extras;
+		}
+		ResolvedDrawVersion = Version;
+	}
+	return ResolvedDraw;
+}
+
+const FManipulatorSettingsMainConstraints& UManipulatorComponent::GetConstraintSettings() const
+{
+	return IsValid(Preset) && PresetOverrides.bOverride_Constraints == false ? Preset->Constraints : Settings.Constraints;
+}
+
+const TArray<FManipulatorDrawShape>& UManipulatorComponent::GetDrawShapes()
+{
+	const uint32 Version = GetSettingsVersion();
+	if (DrawShapesVersion != Version)
+	{
+		RebuildDrawShapes();
+		DrawShapesVersion = Version;
+	}
+	return DrawShapes;
+}
+
+void UManipulatorComponent::RebuildDrawShapes()
+{
+	const FManipulatorSettingsMainDraw& Draw = GetDrawSettings();
+	const FManipulatorSettingsMainDrawShapes& Shapes = Draw.Shapes;
+	TArray<FManipulatorSettingsMainDrawWireBox> WireBoxes = GetAllShapesOfTypeWireBox();
+
+	DrawShapes.Reset(WireBoxes.Num() + Shapes.WireDiamonds.Num() + Shapes.Planes.Num() + Shapes.WireCircles.Num());
+
+	FTransform OverallSize = FTransform::Identity;
+	OverallSize.SetScale3D(FVector(Draw.OverallSize));
+
+	// Keep the same order the shapes have always been drawn in so overlapping shapes still layer the same way.
+	for (const FManipulatorSettingsMainDrawWireBox& WireBox : WireBoxes)
+	{
+		FManipulatorDrawShape& Shape = DrawShapes[DrawShapes.AddDefaulted()];
+		Shape.Type = EManipulatorPropertyDrawType::MDT_BOXWIRE;
+		Shape.LocalTransform = CombineOffsetTransforms(WireBox.Offsets) * OverallSize;
+		Shape.Color = WireBox.Color;
+		Shape.VectorA = WireBox.BoxSize.Min * WireBox.SizeMultiplier;
+		Shape.VectorB = WireBox.BoxSize.Max * WireBox.SizeMultiplier;
+		Shape.Thickness = WireBox.DrawThickness;
+	}
+
+	for (const FManipulatorSettingsMainDrawWireDiamond& WireDiamond : Shapes.WireDiamonds)
+	{
+		FManipulatorDrawShape& Shape = DrawShapes[DrawShapes.AddDefaulted()];
+		Shape.Type = EManipulatorPropertyDrawType::MDT_DIAMONDWIRE;
+		Shape.LocalTransform = CombineOffsetTransforms(WireDiamond.Offsets) * OverallSize;
+		Shape.Color = WireDiamond.Color;
+		Shape.Size = WireDiamond.Size;
+		Shape.Thickness = WireDiamond.DrawThickness;
+	}
+
+	for (const FManipulatorSettingsMainDrawPlane& Plane : Shapes.Planes)
+	{
+		FManipulatorDrawShape& Shape = DrawShapes[DrawShapes.AddDefaulted()];
+		Shape.Type = EManipulatorPropertyDrawType::MDT_PLANE;
+		Shape.LocalTransform = CombineOffsetTransforms(Plane.Offsets) * OverallSize;
+		Shape.Color = Plane.Color;
+		Shape.Size = Plane.Size;
+		Shape.UVRange = FVector2D(Plane.UVMin, Plane.UVMax);
+		Shape.NumSides = Plane.Tessellation == EManipulatorPlaneTessellation::MPT_10X10 ? 10 : 1;
+		Shape.Material = Plane.Material;
+	}
+
+	for (const FManipulatorSettingsMainDrawCircle& Circle : Shapes.WireCircles)
+	{
+		FManipulatorDrawShape& Shape = DrawShapes[DrawShapes.AddDefaulted()];
+		Shape.Type = EManipulatorPropertyDrawType::MDT_CIRCLE;
+		Shape.LocalTransform = CombineOffsetTransforms(Circle.Offsets) * OverallSize;
+		Shape.Color = Circle.Color;
+		Shape.VectorA = Circle.Rotation.RotateVector(FVector(1, 0, 0));
+		Shape.VectorB = Circle.Rotation.RotateVector(FVector(0, 1, 0));
+		Shape.Size = Circle.Radius;
+		Shape.Thickness = Circle.DrawThickness;
+		Shape.NumSides = Circle.NumSides;
+	}
 }
 
 FTransform UManipulatorComponent::CombineOffsetTransforms(TArray<FTransform> Offsets)
@@ -87,21 +342,36 @@ FTransform UManipulatorComponent::CombineOffsetTransforms(TArray<FTransform> Off
 
 FString UManipulatorComponent::GetManipulatorID()
 {
+	return GetManipulatorIDForIndex(Settings.Property.Index);
+}
+
+FString UManipulatorComponent::GetManipulatorIDForIndex(int32 PropertyIndex) const
+{
+	if (DrivesAllArrayElements() == false)
+	{
+		PropertyIndex = Settings.Property.Index;
+	}
 	FString ManipulatorID;
-	ManipulatorID = this->GetOwner()->GetName() + "_" + this->GetName() + "_" + Settings.Property.NameToEdit + "_" + FString::FromInt(Settings.Property.Index);
+	ManipulatorID = GetOwner()->GetName() + "_" + GetName() + "_" + Settings.Property.NameToEdit + "_" + FString::FromInt(PropertyIndex);
 	return ManipulatorID;
 }
 
+bool UManipulatorComponent::DrivesAllArrayElements() const
+{
+	return Settings.Property.UseAllArrayElements && (Settings.Property.Type == EManipulatorPropertyType::MT_TRANSFORM || Settings.Property.Type == EManipulatorPropertyType::MT_VECTOR);
+}
+
 // ========= WIRE BOX =========
 
 TArray<FManipulatorSettingsMainDrawWireBox> UManipulatorComponent::GetAllShapesOfTypeWireBox()
 {
-	TArray<FManipulatorSettingsMainDrawWireBox> WireBoxes = Settings.Draw.Shapes.WireBoxes;
+	const FManipulatorSettingsMainDrawShapes& Shapes = GetDrawSettings().Shapes;
+	TArray<FManipulatorSettingsMainDrawWireBox> WireBoxes = Shapes.WireBoxes;
 	// If all the shapes are empty, then we are going to draw a wire box.
-	if (Settings.Draw.Shapes.WireBoxes.Num() == 0 
-		&& Settings.Draw.Shapes.Planes.Num() == 0 
-		&& Settings.Draw.Shapes.WireCircles.Num() == 0 
-		&& Settings.Draw.Shapes.WireDiamonds.Num() == 0)
+	if (Shapes.WireBoxes.Num() == 0 
+		&& Shapes.Planes.Num() == 0 
+		&& Shapes.WireCircles.Num() == 0 
+		&& Shapes.WireDiamonds.Num() == 0)
 	{
 		FManipulatorSettingsMainDrawWireBox NewWireBox = FManipulatorSettingsMainDrawWireBox();
 		NewWireBox.Color = FLinearColor(1, 1, 1, 1);
@@ -113,10 +383,11 @@ TArray<FManipulatorSettingsMainDrawWireBox> UManipulatorComponent::GetAllShapesO
 
 FManipulatorSettingsMainDrawWireBox UManipulatorComponent::GetShapeOfTypeWireBox(bool& Success, int32 Index)
 {
-	if(Settings.Draw.Shapes.WireBoxes.IsValidIndex(Index))
+	const TArray<FManipulatorSettingsMainDrawWireBox>& Shapes = GetDrawSettings().Shapes.WireBoxes;
+	if(Shapes.IsValidIndex(Index))
 	{
 		Success = true;
-		return Settings.Draw.Shapes.WireBoxes[Index];
+		return Shapes[Index];
 	}
 	else
 	{
@@ -127,22 +398,32 @@ FManipulatorSettingsMainDrawWireBox UManipulatorComponent::GetShapeOfTypeWireBox
 
 void UManipulatorComponent::SetShapeOfTypeWireBox(int32 Index, FManipulatorSettingsMainDrawWireBox WireBox)
 {
+	OverridePresetValue(PresetOverrides.bOverride_Shapes, Settings.Draw.Shapes, Preset ? &Preset->Draw.Shapes : nullptr);
 	SetArrayElement(WireBox, Settings.Draw.Shapes.WireBoxes, Index);
+	NotifySettingsChanged();
+}
+
+void UManipulatorComponent::SetAllShapesOfTypeWireBox(TArray<FManipulatorSettingsMainDrawWireBox> WireBoxes)
+{
+	OverridePresetValue(PresetOverrides.bOverride_Shapes, Settings.Draw.Shapes, Preset ? &Preset->Draw.Shapes : nullptr);
+	Settings.Draw.Shapes.WireBoxes = MoveTemp(WireBoxes);
+	NotifySettingsChanged();
 }
 
 // ========= WIRE DIAMOND =========
 
 TArray<FManipulatorSettingsMainDrawWireDiamond> UManipulatorComponent::GetAllShapesOfTypeWireDiamond()
 {
-	return Settings.Draw.Shapes.WireDiamonds;
+	return GetDrawSettings().Shapes.WireDiamonds;
 }
 
 FManipulatorSettingsMainDrawWireDiamond UManipulatorComponent::GetShapeOfTypeWireDiamond(bool& Success, int32 Index)
 {
-	if (Settings.Draw.Shapes.WireDiamonds.IsValidIndex(Index))
+	const TArray<FManipulatorSettingsMainDrawWireDiamond>& Shapes = GetDrawSettings().Shapes.WireDiamonds;
+	if (Shapes.IsValidIndex(Index))
 	{
 		Success = true;
-		return Settings.Draw.Shapes.WireDiamonds[Index];
+		return Shapes[Index];
 	}
 	else
 	{
@@ -153,22 +434,32 @@ FManipulatorSettingsMainDrawWireDiamond UManipulatorComponent::GetShapeOfTypeWir
 
 void UManipulatorComponent::SetShapeOfTypeWireDiamond(int32 Index, FManipulatorSettingsMainDrawWireDiamond WireDiamond)
 {
+	OverridePresetValue(PresetOverrides.bOverride_Shapes, Settings.Draw.Shapes, Preset ? &Preset->Draw.Shapes : nullptr);
 	SetArrayElement(WireDiamond, Settings.Draw.Shapes.WireDiamonds, Index);
+	NotifySettingsChanged();
+}
+
+void UManipulatorComponent::SetAllShapesOfTypeWireDiamond(TArray<FManipulatorSettingsMainDrawWireDiamond> WireDiamonds)
+{
+	OverridePresetValue(PresetOverrides.bOverride_Shapes, Settings.Draw.Shapes, Preset ? &Preset->Draw.Shapes : nullptr);
+	Settings.Draw.Shapes.WireDiamonds = MoveTemp(WireDiamonds);
+	NotifySettingsChanged();
 }
 
 // ========= CIRCLES =========
 
 TArray<FManipulatorSettingsMainDrawCircle> UManipulatorComponent::GetAllShapesOfTypeWireCircle()
 {
-	return Settings.Draw.Shapes.WireCircles;
+	return GetDrawSettings().Shapes.WireCircles;
 }
 
 FManipulatorSettingsMainDrawCircle UManipulatorComponent::GetShapeOfTypeWireCircle(bool& Success, int32 Index)
 {
-	if (Settings.Draw.Shapes.WireCircles.IsValidIndex(Index))
+	const TArray<FManipulatorSettingsMainDrawCircle>& Shapes = GetDrawSettings().Shapes.WireCircles;
+	if (Shapes.IsValidIndex(Index))
 	{
 		Success = true;
-		return Settings.Draw.Shapes.WireCircles[Index];
+		return Shapes[Index];
 	}
 	else
 	{
@@ -179,22 +470,32 @@ FManipulatorSettingsMainDrawCircle UManipulatorComponent::GetShapeOfTypeWireCirc
 
 void UManipulatorComponent::SetShapeOfTypeWireCircle(int32 Index, FManipulatorSettingsMainDrawCircle WireCircle)
 {
+	OverridePresetValue(PresetOverrides.bOverride_Shapes, Settings.Draw.Shapes, Preset ? &Preset->Draw.Shapes : nullptr);
 	SetArrayElement(WireCircle, Settings.Draw.Shapes.WireCircles, Index);
+	NotifySettingsChanged();
+}
+
+void UManipulatorComponent::SetAllShapesOfTypeWireCircle(TArray<FManipulatorSettingsMainDrawCircle> WireCircles)
+{
+	OverridePresetValue(PresetOverrides.bOverride_Shapes, Settings.Draw.Shapes, Preset ? &Preset->Draw.Shapes : nullptr);
+	Settings.Draw.Shapes.WireCircles = MoveTemp(WireCircles);
+	NotifySettingsChanged();
 }
 
 // ========= PLANES =========
 
 TArray<FManipulatorSettingsMainDrawPlane> UManipulatorComponent::GetAllShapesOfTypePlane()
 {
-	return Settings.Draw.Shapes.Planes;
+	return GetDrawSettings().Shapes.Planes;
 }
 
 FManipulatorSettingsMainDrawPlane UManipulatorComponent::GetShapeOfTypePlane(bool& Success, int32 Index)
 {
-	if (Settings.Draw.Shapes.Planes.IsValidIndex(Index))
+	const TArray<FManipulatorSettingsMainDrawPlane>& Shapes = GetDrawSettings().Shapes.Planes;
+	if (Shapes.IsValidIndex(Index))
 	{
 		Success = true;
-		return Settings.Draw.Shapes.Planes[Index];
+		return Shapes[Index];
 	}
 	else
 	{
@@ -205,28 +506,65 @@ FManipulatorSettingsMainDrawPlane UManipulatorComponent::GetShapeOfTypePlane(boo
 
 void UManipulatorComponent::SetShapeOfTypePlane(int32 Index, FManipulatorSettingsMainDrawPlane Plane)
 {
+	OverridePresetValue(PresetOverrides.bOverride_Shapes, Settings.Draw.Shapes, Preset ? &Preset->Draw.Shapes : nullptr);
 	SetArrayElement(Plane, Settings.Draw.Shapes.Planes, Index);
+	NotifySettingsChanged();
+}
+
+void UManipulatorComponent::SetAllShapesOfTypePlane(TArray<FManipulatorSettingsMainDrawPlane> Planes)
+{
+	OverridePresetValue(PresetOverrides.bOverride_Shapes, Settings.Draw.Shapes, Preset ? &Preset->Draw.Shapes : nullptr);
+	Settings.Draw.Shapes.Planes = MoveTemp(Planes);
+	NotifySettingsChanged();
 }
 
 FTransform UManipulatorComponent::GetSocketTransform(FName InSocketName, ERelativeTransformSpace TransformSpace) const
 {
-	if (Settings.Draw.Extras.UseAttachedSocketAsInitialOffset)
+	if (GetDrawSettings().Extras.UseAttachedSocketAsInitialOffset)
 	{
-		const USceneComponent* Top;
-		// Recursively try to find the top most component to get its socket information. 
-		for (Top = this; IsValid(Top) && IsValid(Top->GetAttachParent()) && IsValid(Cast<UMeshComponent>(Top)) == false; Top = Top->GetAttachParent());
-
-		// Make sure the top most component isn't itself... 
-		if (IsValid(Top) && Top != this && IsValid(Cast<UManipulatorComponent>(Top)) == false)
+		if (IsSocketCacheValid(InSocketName) == false)
 		{
-			FString Name = Top->GetName();
-			return Top->GetSocketTransform(InSocketName, TransformSpace);
+			ResolveSocketCache(InSocketName);
 		}
-		else
+
+		// No usable component above this one.
+		const USceneComponent* Top = CachedSocketParent.Get();
+		if (Top == nullptr)
 		{
 			return Super::GetSocketTransform(InSocketName, TransformSpace);
 			//return FTransform::Identity;
 		}
+
+		FTransform SocketTransform = FTransform::Identity;
+		const USkinnedMeshComponent* SkinnedMesh = CachedSocketSkinnedMesh.Get();
+		if (SkinnedMesh != nullptr && CachedSocketBoneIndex != INDEX_NONE && TransformSpace != RTS_ParentBoneSpace)
+		{
+			SocketTransform = CachedSocketLocalTransform * SkinnedMesh->GetBoneTransform(CachedSocketBoneIndex);
+		}
+		else if (CachedSocketStaticMesh.IsValid() && TransformSpace != RTS_ParentBoneSpace)
+		{
+			SocketTransform = CachedSocketLocalTransform * Top->GetComponentTransform();
+		}
+		else
+		{
+			// Unknown bones, bone space and plain scene components are left to the component itself.
+			return Top->GetSocketTransform(InSocketName, TransformSpace);
+		}
+
+		switch (TransformSpace)
+		{
+		case RTS_Actor:
+			if (const AActor* Actor = Top->GetOwner())
+			{
+				return SocketTransform.GetRelativeTransform(Actor->GetTransform());
+			}
+			break;
+		case RTS_Component:
+			return SocketTransform.GetRelativeTransform(Top->GetComponentTransform());
+		default:
+			break;
+		}
+		return SocketTransform;
 	}
 	else
 	{
@@ -234,20 +572,297 @@ FTransform UManipulatorComponent::GetSocketTransform(FName InSocketName, ERelati
 	}
 }
 
+void UManipulatorComponent::GetAttachedSocketTransforms(const TArray<UManipulatorComponent*>& Manipulators, TArray<FTransform>& OutTransforms)
+{
+	OutTransforms.SetNum(Manipulators.Num());
+
+	// Rigs usually hang everything off one or two meshes so a flat list is quicker than a map here.
+	struct FSocketMeshBatch
+	{
+		const USkinnedMeshComponent* Mesh;
+		TArray<int32> ManipulatorIndices;
+	};
+	TArray<FSocketMeshBatch, TInlineAllocator<4>> Batches;
+
+	for (int32 ManipulatorIndex = 0; ManipulatorIndex < Manipulators.Num(); ManipulatorIndex++)
+	{
+		const UManipulatorComponent* Manipulator = Manipulators[ManipulatorIndex];
+		if (IsValid(Manipulator) == false)
+		{
+			OutTransforms[ManipulatorIndex] = FTransform::Identity;
+			continue;
+		}
+
+		const FName SocketName = Manipulator->GetAttachSocketName();
+		const USkinnedMeshComponent* SkinnedMesh = nullptr;
+		if (Manipulator->GetDrawSettings().Extras.UseAttachedSocketAsInitialOffset)
+		{
+			if (Manipulator->IsSocketCacheValid(SocketName) == false)
+			{
+				Manipulator->ResolveSocketCache(SocketName);
+			}
+			SkinnedMesh = Manipulator->CachedSocketSkinnedMesh.Get();
+		}
+
+		// Slave meshes read their bones through the master pose, leave those and anything that isn't a bone on a skeletal mesh to the single lookup.
+		if (SkinnedMesh == nullptr || Manipulator->CachedSocketBoneIndex == INDEX_NONE || SkinnedMesh->MasterPoseComponent.IsValid())
+		{
+			OutTransforms[ManipulatorIndex] = Manipulator->GetSocketTransform(SocketName, RTS_Actor);
+			continue;
+		}
+
+		FSocketMeshBatch* Batch = Batches.FindByPredicate([SkinnedMesh](const FSocketMeshBatch& Existing) { return Existing.Mesh == SkinnedMesh; });
+		if (Batch == nullptr)
+		{
+			Batch = &Batches[Batches.AddDefaulted()];
+			Batch->Mesh = SkinnedMesh;
+		}
+		Batch->ManipulatorIndices.Add(ManipulatorIndex);
+	}
+
+	TMap<int32, FTransform> BoneToActorTransforms;
+	for (const FSocketMeshBatch& Batch : Batches)
+	{
+		const TArray<FTransform>& ComponentSpaceTransforms = Batch.Mesh->GetComponentSpaceTransforms();
+		const AActor* MeshOwner = Batch.Mesh->GetOwner();
+		const FTransform ComponentToActor = MeshOwner ? Batch.Mesh->GetComponentTransform().GetRelativeTransform(MeshOwner->GetTransform()) : Batch.Mesh->GetComponentTransform();
+
+		BoneToActorTransforms.Reset();
+		for (int32 ManipulatorIndex : Batch.ManipulatorIndices)
+		{
+			const UManipulatorComponent* Manipulator = Manipulators[ManipulatorIndex];
+			const int32 BoneIndex = Manipulator->CachedSocketBoneIndex;
+			if (ComponentSpaceTransforms.IsValidIndex(BoneIndex) == false)
+			{
+				OutTransforms[ManipulatorIndex] = Manipulator->GetSocketTransform(Manipulator->GetAttachSocketName(), RTS_Actor);
+				continue;
+			}
+
+			FTransform* BoneToActor = BoneToActorTransforms.Find(BoneIndex);
+			if (BoneToActor == nullptr)
+			{
+				BoneToActor = &BoneToActorTransforms.Add(BoneIndex, ComponentSpaceTransforms[BoneIndex] * ComponentToActor);
+			}
+			OutTransforms[ManipulatorIndex] = Manipulator->CachedSocketLocalTransform * *BoneToActor;
+		}
+	}
+}
+
+void UManipulatorComponent::OnAttachmentChanged()
+{
+	Super::OnAttachmentChanged();
+	bSocketCacheResolved = false;
+}
+
+bool UManipulatorComponent::IsSocketCacheValid(FName InSocketName) const
+{
+	return bSocketCacheResolved
+		&& CachedSocketName == InSocketName
+		&& CachedSocketAttachParent.Get() == GetAttachParent()
+		&& CachedSocketParent.IsStale() == false
+		&& CachedSocketMeshAsset.Get() == GetCachedSocketMeshAsset();
+}
+
+const UObject* UManipulatorComponent::GetCachedSocketMeshAsset() const
+{
+	if (const USkinnedMeshComponent* SkinnedMesh = CachedSocketSkinnedMesh.Get())
+	{
+		return SkinnedMesh->SkeletalMesh;
+	}
+	if (const UStaticMeshComponent* StaticMeshComponent = CachedSocketStaticMesh.Get())
+	{
+		return StaticMeshComponent->GetStaticMesh();
+	}
+	return nullptr;
+}
+
+void UManipulatorComponent::ResolveSocketCache(FName InSocketName) const
+{
+	bSocketCacheResolved = true;
+	CachedSocketName = InSocketName;
+	CachedSocketAttachParent = GetAttachParent();
+	CachedSocketParent = nullptr;
+	CachedSocketSkinnedMesh = nullptr;
+	CachedSocketStaticMesh = nullptr;
+	CachedSocketBoneIndex = INDEX_NONE;
+	CachedSocketLocalTransform = FTransform::Identity;
+
+	const USceneComponent* Top;
+	// Recursively try to find the top most component to get its socket information. 
+	for (Top = this; IsValid(Top) && IsValid(Top->GetAttachParent()) && IsValid(Cast<UMeshComponent>(Top)) == false; Top = Top->GetAttachParent());
+
+	// Make sure the top most component isn't itself... 
+	if (IsValid(Top) == false || Top == this || IsValid(Cast<UManipulatorComponent>(Top)))
+	{
+		CachedSocketMeshAsset = nullptr;
+		return;
+	}
+	CachedSocketParent = Top;
+
+	if (const USkinnedMeshComponent* SkinnedMesh = Cast<USkinnedMeshComponent>(Top))
+	{
+		CachedSocketSkinnedMesh = SkinnedMesh;
+		if (const USkeletalMeshSocket* Socket = SkinnedMesh->GetSocketByName(InSocketName))
+		{
+			CachedSocketBoneIndex = SkinnedMesh->GetBoneIndex(Socket->BoneName);
+			CachedSocketLocalTransform = Socket->GetSocketLocalTransform();
+		}
+		else
+		{
+			CachedSocketBoneIndex = SkinnedMesh->GetBoneIndex(InSocketName);
+		}
+	}
+	else if (const UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Top))
+	{
+		CachedSocketStaticMesh = StaticMeshComponent;
+		UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh();
+		if (const UStaticMeshSocket* Socket = StaticMesh ? StaticMesh->FindSocket(InSocketName) : nullptr)
+		{
+			CachedSocketLocalTransform = FTransform(Socket->RelativeRotation, Socket->RelativeLocation, Socket->RelativeScale);
+		}
+	}
+	CachedSocketMeshAsset = GetCachedSocketMeshAsset();
+}
+
 // Called when the game starts
 void UManipulatorComponent::BeginPlay()
 {
 	Super::BeginPlay();
 }
 
+namespace
+{
+	/** Requests from every manipulator, drained by the manipulator mode once per frame instead of it polling each component. */
+	TArray<FManipulatorSelectionRequest> PendingSelectionRequests;
+
+	/** Manipulators whose selection state changed since the last broadcast, the mode changes it while rendering so the event waits for its tick. */
+	TArray<TWeakObjectPtr<UManipulatorComponent>> PendingSelectionBroadcasts;
+
+	/** Every registered manipulator by id. */
+	TMap<FGuid, TWeakObjectPtr<UManipulatorComponent>> ManipulatorsByGuid;
+
+	/** Carries the id over to the component the construction script recreates. */
+	class FManipulatorComponentInstanceData : public FSceneComponentInstanceData
+	{
+	public:
+		FManipulatorComponentInstanceData(const UManipulatorComponent* SourceComponent)
+			: FSceneComponentInstanceData(SourceComponent)
+			, ManipulatorGuid(SourceComponent->GetManipulatorGuid())
+		{
+		}
+
+		virtual bool ContainsData() const override
+		{
+			return ManipulatorGuid.IsValid() || FSceneComponentInstanceData::ContainsData();
+		}
+
+		virtual void ApplyToComponent(UActorComponent* Component, const ECacheApplyPhase CacheApplyPhase) override
+		{
+			FSceneComponentInstanceData::ApplyToComponent(Component, CacheApplyPhase);
+			if (CacheApplyPhase == ECacheApplyPhase::PostUserConstructionScript)
+			{
+				CastChecked<UManipulatorComponent>(Component)->ApplyManipulatorGuid(ManipulatorGuid);
+			}
+		}
+
+	private:
+		FGuid ManipulatorGuid;
+	};
+}
+
+UManipulatorComponent* UManipulatorComponent::FindManipulatorByGuid(const FGuid& Guid)
+{
+	const TWeakObjectPtr<UManipulatorComponent>* Manipulator = ManipulatorsByGuid.Find(Guid);
+	return Manipulator ? Manipulator->Get() : nullptr;
+}
+
+void UManipulatorComponent::OnRegister()
+{
+	Super::OnRegister();
+	RegisterManipulatorGuid();
+}
+
+void UManipulatorComponent::OnUnregister()
+{
+	UnregisterManipulatorGuid();
+	Super::OnUnregister();
+}
+
+void UManipulatorComponent::BeginDestroy()
+{
+	UnregisterManipulatorGuid();
+	Super::BeginDestroy();
+}
+
+void UManipulatorComponent::PostDuplicate(bool bDuplicateForPIE)
+{
+	Super::PostDuplicate(bDuplicateForPIE);
+
+	// A copy, including the one made for PIE, is a different manipulator and must not take the lookup over from the original.
+	ManipulatorGuid.Invalidate();
+}
+
+FActorComponentInstanceData* UManipulatorComponent::GetComponentInstanceData() const
+{
+	return new FManipulatorComponentInstanceData(this);
+}
+
+void UManipulatorComponent::ApplyManipulatorGuid(const FGuid& Guid)
+{
+	if (Guid.IsValid() == false || Guid == ManipulatorGuid)
+	{
+		return;
+	}
+
+	const bool bWasRegistered = FindManipulatorByGuid(ManipulatorGuid) == this;
+	UnregisterManipulatorGuid();
+	ManipulatorGuid = Guid;
+	if (bWasRegistered)
+	{
+		RegisterManipulatorGuid();
+	}
+}
+
+void UManipulatorComponent::RegisterManipulatorGuid()
+{
+	if (GetOwner() == nullptr || HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		return;
+	}
+
+	if (ManipulatorGuid.IsValid() == false)
+	{
+		ManipulatorGuid = FGuid::NewGuid();
+	}
+	ManipulatorsByGuid.Add(ManipulatorGuid, this);
+}
+
+void UManipulatorComponent::UnregisterManipulatorGuid()
+{
+	if (ManipulatorGuid.IsValid() == false)
+	{
+		return;
+	}
+
+	const TWeakObjectPtr<UManipulatorComponent>* Registered = ManipulatorsByGuid.Find(ManipulatorGuid);
+	if (Registered != nullptr && (Registered->IsValid() == false || Registered->Get() == this))
+	{
+		ManipulatorsByGuid.Remove(ManipulatorGuid);
+	}
+}
+
 void UManipulatorComponent::ForceSelectManipulator()
 {
 	bShouldSelect = true;
+	bShouldDeselect = false;
+	QueueSelectionRequest(this, true);
 }
 
 void UManipulatorComponent::ForceDeselectManipulator()
 {
 	bShouldDeselect = true;
+	bShouldSelect = false;
+	QueueSelectionRequest(this, false);
 }
 
 bool UManipulatorComponent::IsManipulatorSelected() const
@@ -255,6 +870,50 @@ bool UManipulatorComponent::IsManipulatorSelected() const
 	return bIsManipulatorSelected;
 }
 
+void UManipulatorComponent::SetManipulatorSelected(bool bSelected)
+{
+	if (bIsManipulatorSelected != bSelected)
+	{
+		bIsManipulatorSelected = bSelected;
+		PendingSelectionBroadcasts.AddUnique(this);
+	}
+}
+
+void UManipulatorComponent::BroadcastSelectionChanges()
+{
+	// Taken first so handlers that change the selection again queue for the next tick.
+	TArray<TWeakObjectPtr<UManipulatorComponent>> Broadcasts = MoveTemp(PendingSelectionBroadcasts);
+	PendingSelectionBroadcasts.Reset();
+	for (const TWeakObjectPtr<UManipulatorComponent>& WeakComponent : Broadcasts)
+	{
+		UManipulatorComponent* Component = WeakComponent.Get();
+		if (IsValid(Component))
+		{
+			Component->OnManipulatorSelectionChanged.Broadcast(Component, Component->bIsManipulatorSelected);
+		}
+	}
+}
+
+void UManipulatorComponent::TakeSelectionRequests(TArray<FManipulatorSelectionRequest>& OutRequests)
+{
+	OutRequests = MoveTemp(PendingSelectionRequests);
+	PendingSelectionRequests.Reset();
+}
+
+void UManipulatorComponent::QueueSelectionRequest(UManipulatorComponent* Component, bool bSelect)
+{
+	// Only the latest request per manipulator matters, this also keeps the queue from growing while requests wait.
+	PendingSelectionRequests.RemoveAll([Component](const FManipulatorSelectionRequest& Request)
+	{
+		return Request.Component == Component || Request.Component.IsValid() == false;
+	});
+
+	FManipulatorSelectionRequest Request;
+	Request.Component = Component;
+	Request.Select = bSelect;
+	PendingSelectionRequests.Add(Request);
+}
+
 #if WITH_EDITOR
 bool UManipulatorComponent::CanEditChange(const UProperty* InProperty) const
 {
@@ -279,5 +938,113 @@ bool UManipulatorComponent::CanEditChange(const UProperty* InProperty) const
 
 	return ParentVal;
 }
+
+void UManipulatorComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	const FName MemberPropertyName = PropertyChangedEvent.MemberProperty ? PropertyChangedEvent.MemberProperty->GetFName() : NAME_None;
+	if ((MemberPropertyName == GET_MEMBER_NAME_CHECKED(UManipulatorComponent, Preset) || MemberPropertyName == GET_MEMBER_NAME_CHECKED(UManipulatorComponent, PresetOverrides))
+		&& IsValid(Preset))
+	{
+		SyncSettingsWithPreset(PropertyChangedEvent.GetPropertyName());
+	}
+	NotifySettingsChanged();
+}
+
+void UManipulatorComponent::PostEditChangeChainProperty(FPropertyChangedChainEvent& PropertyChangedEvent)
+{
+	// Editing a section the preset supplies ticks its override, otherwise the edit would be thrown away by the next sync with the preset.
+	if (IsValid(Preset))
+	{
+		TArray<FName, TInlineAllocator<4>> ChainNames;
+		for (const UProperty* ChainProperty : PropertyChangedEvent.PropertyChain)
+		{
+			ChainNames.Add(ChainProperty->GetFName());
+		}
+
+		bool* Override = nullptr;
+		if (ChainNames.Num() >= 2 && ChainNames[0] == GET_MEMBER_NAME_CHECKED(UManipulatorComponent, Settings))
+		{
+			if (ChainNames[1] == GET_MEMBER_NAME_CHECKED(FManipulatorSettingsMain, Constraints))
+			{
+				Override = &PresetOverrides.bOverride_Constraints;
+			}
+			else if (ChainNames[1] == GET_MEMBER_NAME_CHECKED(FManipulatorSettingsMain, Draw) && ChainNames.Num() >= 3)
+			{
+				const FName DrawName = ChainNames[2];
+				if (DrawName == GET_MEMBER_NAME_CHECKED(FManipulatorSettingsMainDraw, BaseColor) || DrawName == GET_MEMBER_NAME_CHECKED(FManipulatorSettingsMainDraw, SelectedColor))
+				{
+					Override = &PresetOverrides.bOverride_Colors;
+				}
+				else if (DrawName == GET_MEMBER_NAME_CHECKED(FManipulatorSettingsMainDraw, OverallSize))
+				{
+					Override = &PresetOverrides.bOverride_OverallSize;
+				}
+				else if (DrawName == GET_MEMBER_NAME_CHECKED(FManipulatorSettingsMainDraw, Offsets))
+				{
+					Override = &PresetOverrides.bOverride_Offsets;
+				}
+				else if (DrawName == GET_MEMBER_NAME_CHECKED(FManipulatorSettingsMainDraw, Shapes))
+				{
+					Override = &PresetOverrides.bOverride_Shapes;
+				}
+				else if (DrawName == GET_MEMBER_NAME_CHECKED(FManipulatorSettingsMainDraw, Extras))
+				{
+					Override = &PresetOverrides.bOverride_Extras;
+				}
+			}
+		}
+
+		if (Override != nullptr)
+		{
+			*Override = true;
+		}
+	}
+
+	Super::PostEditChangeChainProperty(PropertyChangedEvent);
+}
+
+void UManipulatorComponent::SyncSettingsWithPreset(FName ChangedOverride)
+{
+	// Sections the preset supplies go back to defaults so they don't get saved per component, a newly ticked override starts from the preset's value.
+	const FManipulatorSettingsMainDraw DefaultDraw;
+	const auto SyncSection = [ChangedOverride](bool bOverride, FName OverrideName, auto& Value, const auto& PresetValue, const auto& DefaultValue)
+	{
+		if (bOverride == false)
+		{
+			Value = DefaultValue;
+		}
+		else if (ChangedOverride == OverrideName)
+		{
+			Value = PresetValue;
+		}
+	};
+	SyncSection(PresetOverrides.bOverride_Colors, GET_MEMBER_NAME_CHECKED(FManipulatorPresetOverrides, bOverride_Colors), Settings.Draw.BaseColor, Preset->Draw.BaseColor, DefaultDraw.BaseColor);
+	SyncSection(PresetOverrides.bOverride_Colors, GET_MEMBER_NAME_CHECKED(FManipulatorPresetOverrides, bOverride_Colors), Settings.Draw.SelectedColor, Preset->Draw.SelectedColor, DefaultDraw.SelectedColor);
+	SyncSection(PresetOverrides.bOverride_OverallSize, GET_MEMBER_NAME_CHECKED(FManipulatorPresetOverrides, bOverride_OverallSize), Settings.Draw.OverallSize, Preset->Draw.OverallSize, DefaultDraw.OverallSize);
+	SyncSection(PresetOverrides.bOverride_Offsets, GET_MEMBER_NAME_CHECKED(FManipulatorPresetOverrides, bOverride_Offsets), Settings.Draw.Offsets, Preset->Draw.Offsets, DefaultDraw.Offsets);
+	SyncSection(PresetOverrides.bOverride_Shapes, GET_MEMBER_NAME_CHECKED(FManipulatorPresetOverrides, bOverride_Shapes), Settings.Draw.Shapes, Preset->Draw.Shapes, DefaultDraw.Shapes);
+	SyncSection(PresetOverrides.bOverride_Extras, GET_MEMBER_NAME_CHECKED(FManipulatorPresetOverrides, bOverride_Extras), Settings.Draw.Extras, Preset->Draw.Extras, DefaultDraw.Extras);
+	SyncSection(PresetOverrides.bOverride_Constraints, GET_MEMBER_NAME_CHECKED(FManipulatorPresetOverrides, bOverride_Constraints), Settings.Constraints, Preset->Constraints, FManipulatorSettingsMainConstraints());
+}
+
+void UManipulatorComponent::PostEditUndo()
+{
+	Super::PostEditUndo();
+	NotifySettingsChanged();
+}
+
+void UManipulatorComponent::PostEditImport()
+{
+	Super::PostEditImport();
+
+	// Pasted manipulators are new ones, the id they were copied with still belongs to the original.
+	const bool bWasRegistered = FindManipulatorByGuid(ManipulatorGuid) == this;
+	ManipulatorGuid = FGuid::NewGuid();
+	if (bWasRegistered)
+	{
+		RegisterManipulatorGuid();
+	}
+}
 #endif
 
@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ManipulatorPoseLibrary.h"
+
+void UManipulatorPoseLibrary::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	int32 NumPayloads = PoseData.Num();
+	Ar << NumPayloads;
+	if (Ar.IsLoading())
+	{
+		PoseData.Empty(NumPayloads);
+		for (int32 i = 0; i < NumPayloads; i++)
+		{
+			PoseData.Add(new FByteBulkData());
+		}
+	}
+
+	for (int32 i = 0; i < NumPayloads; i++)
+	{
+		// Payloads stay in the package file until a pose is actually applied.
+		PoseData[i].SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+		PoseData[i].Serialize(Ar, this, i);
+	}
+
+	// Keep one payload per entry even if the two ever get out of step.
+	if (Ar.IsLoading())
+	{
+		while (PoseData.Num() < Poses.Num())
+		{
+			PoseData.Add(new FByteBulkData());
+		}
+	}
+}
+
+int32 UManipulatorPoseLibrary::FindPoseIndex(FName PoseName) const
+{
+	return Poses.IndexOfByPredicate([PoseName](const FManipulatorPoseLibraryEntry& Entry)
+	{
+		return Entry.Name == PoseName;
+	});
+}
+
+bool UManipulatorPoseLibrary::LoadPoseData(int32 PoseIndex, TArray<uint8>& OutData) const
+{
+	OutData.Reset();
+	if (!PoseData.IsValidIndex(PoseIndex))
+	{
+		return false;
+	}
+
+	FByteBulkData& BulkData = const_cast<FByteBulkData&>(PoseData[PoseIndex]);
+	const int32 DataSize = BulkData.GetBulkDataSize();
+	if (DataSize <= 0)
+	{
+		return false;
+	}
+
+	// Reads straight into OutData and doesn't keep a resident copy around if the payload can be loaded again later.
+	OutData.SetNumUninitialized(DataSize);
+	void* Dest = OutData.GetData();
+	BulkData.GetCopy(&Dest, true);
+	return true;
+}
+
+int32 UManipulatorPoseLibrary::SetPoseData(FName PoseName, TSoftClassPtr<AActor> ActorClass, const TArray<uint8>& Data, int32 NumValues)
+{
+	int32 PoseIndex = FindPoseIndex(PoseName);
+	if (PoseIndex == INDEX_NONE)
+	{
+		PoseIndex = Poses.AddDefaulted();
+		Poses[PoseIndex].Name = PoseName;
+		PoseData.Add(new FByteBulkData());
+	}
+
+	FManipulatorPoseLibraryEntry& Entry = Poses[PoseIndex];
+	Entry.ActorClass = ActorClass;
+	Entry.NumValues = NumValues;
+
+	FByteBulkData& BulkData = PoseData[PoseIndex];
+	BulkData.Lock(LOCK_READ_WRITE);
+	void* Dest = BulkData.Realloc(Data.Num());
+	FMemory::Memcpy(Dest, Data.GetData(), Data.Num());
+	BulkData.Unlock();
+
+	return PoseIndex;
+}
+
+void UManipulatorPoseLibrary::RemovePose(int32 PoseIndex)
+{
+	if (Poses.IsValidIndex(PoseIndex))
+	{
+		Poses.RemoveAt(PoseIndex);
+		PoseData.RemoveAt(PoseIndex);
+	}
+}
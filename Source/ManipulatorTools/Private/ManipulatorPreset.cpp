@@ -0,0 +1,17 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ManipulatorPreset.h"
+
+#if WITH_EDITOR
+void UManipulatorPreset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	PresetVersion++;
+}
+
+void UManipulatorPreset::PostEditUndo()
+{
+	Super::PostEditUndo();
+	PresetVersion++;
+}
+#endif
@@ -15,7 +15,29 @@ static void SetArrayElement(T Item, TArray<T>& ItemArray, int32 Index)
 	{
 		ItemArray.SetNum(Index+1);
 	}
-	ItemArray[Index] = Item;
+	ItemArray[Index] = MoveTemp(Item);
+}
+
+/** Writes a run of items starting at StartIndex, growing the array at most once. */
+template <typename T>
+static void SetArrayElements(TArray<T>&& Items, TArray<T>& ItemArray, int32 StartIndex)
+{
+	// Everything already in the array would be overwritten anyway, so just steal the new allocation.
+	if (StartIndex == 0 && ItemArray.Num() <= Items.Num())
+	{
+		ItemArray = MoveTemp(Items);
+		return;
+	}
+
+	const int32 RequiredNum = StartIndex + Items.Num();
+	if (ItemArray.Num() < RequiredNum)
+	{
+		ItemArray.SetNum(RequiredNum);
+	}
+	for (int32 i = 0; i < Items.Num(); i++)
+	{
+		ItemArray[StartIndex + i] = MoveTemp(Items[i]);
+	}
 }
 
 UENUM(BlueprintType)
@@ -44,6 +66,13 @@ enum class EManipulatorPropertyDrawType : uint8
 	MDT_CIRCLE		 UMETA(DisplayName = "Circle")
 };
 
+UENUM(BlueprintType)
+enum class EManipulatorPlaneTessellation : uint8
+{
+	MPT_1X1 	UMETA(DisplayName = "1x1"),
+	MPT_10X10 	UMETA(DisplayName = "10x10")
+};
+
 // Specific Settings for Wire Boxes
 USTRUCT(BlueprintType)
 struct FManipulatorSettingsMainDrawWireBox
@@ -108,6 +137,10 @@ struct FManipulatorSettingsMainDrawPlane
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float UVMax = 1.0f;
 
+	/** Quads the plane is split into, a single quad is enough unless the material bends or lights the plane. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EManipulatorPlaneTessellation Tessellation = EManipulatorPlaneTessellation::MPT_1X1;
+
 	/** Offset Visually*/
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	TArray<FTransform> Offsets;
@@ -294,6 +327,14 @@ struct FManipulatorSettingsMainProperty
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	int Index = 0;
 
+	/** When on, this one manipulator edits every element of an array property and Index is only used for forced selection. Works with Transform and Vector arrays. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool UseAllArrayElements = false;
+
+	/** Component name of the manipulator that mirrors this one when mirror editing is on. Left as None the partner is found by swapping _L/_R or Left/Right in the component name. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FName MirrorPartner = NAME_None;
+
 	/** Settings specifically for Enum Properties */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	FManipulatorSettingsMainPropertyTypeEnum EnumSettings;
@@ -317,6 +358,87 @@ struct FManipulatorSettingsMain
 	FManipulatorSettingsMainConstraints Constraints;
 };
 
+// Which parts of the draw and constraint settings a manipulator keeps for itself instead of reading them from its preset.
+USTRUCT(BlueprintType)
+struct FManipulatorPresetOverrides
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Base and selected color. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bOverride_Colors = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bOverride_OverallSize = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bOverride_Offsets = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bOverride_Shapes = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bOverride_Extras = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bOverride_Constraints = false;
+
+	bool AnyDrawOverridden() const
+	{
+		return bOverride_Colors || bOverride_OverallSize || bOverride_Offsets || bOverride_Shapes || bOverride_Extras;
+	}
+
+	bool AllDrawOverridden() const
+	{
+		return bOverride_Colors && bOverride_OverallSize && bOverride_Offsets && bOverride_Shapes && bOverride_Extras;
+	}
+};
+
+/** A single shape baked down from the draw settings, ready to be drawn on top of the widget transform. */
+struct FManipulatorDrawShape
+{
+	/** Shape offsets combined with the overall size. */
+	FTransform LocalTransform = FTransform::Identity;
+
+	/** Shape color, multiplied with the base or selected color when drawn. */
+	FLinearColor Color = FLinearColor::White;
+
+	/** Box extents already scaled by the box size multiplier, or the circle axes. */
+	FVector VectorA = FVector::ZeroVector;
+	FVector VectorB = FVector::ZeroVector;
+
+	/** Plane UV range. */
+	FVector2D UVRange = FVector2D(0.0f, 1.0f);
+
+	/** Diamond size, plane size or circle radius. */
+	float Size = 0.0f;
+	float Thickness = 1.0f;
+	/** Circle sides or plane quads per side. */
+	int32 NumSides = 0;
+
+	EManipulatorPropertyDrawType Type = EManipulatorPropertyDrawType::MDT_BOXWIRE;
+
+	TWeakObjectPtr<UMaterialInterface> Material;
+};
+
+class UManipulatorComponent;
+class UManipulatorPreset;
+class USkinnedMeshComponent;
+class UStaticMeshComponent;
+
+/** Raised once per settings edit made through the component's setters or the details panel. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnManipulatorSettingsChanged, UManipulatorComponent*);
+
+/** Raised when the manipulator mode selects or deselects a manipulator. */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnManipulatorSelectionChanged, UManipulatorComponent*, Manipulator, bool, IsSelected);
+
+/** A select or deselect request made on a manipulator, handled by the manipulator mode the next frame it updates. */
+struct FManipulatorSelectionRequest
+{
+	TWeakObjectPtr<UManipulatorComponent> Component;
+	bool Select = true;
+};
+
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent), hidecategories = ("Rendering" , "Physics" , "ComponentReplication" , "LOD", "AssetUserData", "Collision", "Activation"))
 class MANIPULATORTOOLS_API UManipulatorComponent : public USceneComponent
 {
@@ -329,10 +451,34 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
 	FManipulatorSettingsMain Settings;
 
+	/** Shared draw and constraint settings. Only the parts ticked in Preset Overrides are kept in Settings, everything else comes from the preset. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	UManipulatorPreset* Preset = nullptr;
+
+	/** Editing a preset supplied section of Settings in the details panel ticks its override. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	FManipulatorPresetOverrides PresetOverrides;
+
+	/** Draw settings with the preset merged in, read these rather than Settings.Draw. Without partial overrides this is the preset's or this component's own data and nothing is copied. */
+	const FManipulatorSettingsMainDraw& GetDrawSettings() const;
+
+	/** Constraints from the preset unless they are overridden. */
+	const FManipulatorSettingsMainConstraints& GetConstraintSettings() const;
+
 	// This is handled automatically by the editor mode, however you can use this to modify other transforms easily.
 	UFUNCTION(BlueprintCallable, BlueprintPure)
 	FTransform ConstrainTransform(FTransform Transform);
 
+	// Same as Constrain Transform but for a whole array of transforms at once.
+	UFUNCTION(BlueprintCallable, BlueprintPure)
+	TArray<FTransform> ConstrainTransforms(TArray<FTransform> Transforms);
+
+	/** Clamps location and scale of every transform in place, working on the transform's vector registers where transforms are vectorized. */
+	void ConstrainTransformsInPlace(TArrayView<FTransform> Transforms) const;
+
+	/** Same result as ConstrainTransformsInPlace with FMath::Clamp on each component, see ManipulatorTools.BenchmarkConstrainTransforms. */
+	void ConstrainTransformsInPlaceScalar(TArrayView<FTransform> Transforms) const;
+
 	// Easy Way to set the colors without navigating through the struct
 	UFUNCTION(BlueprintCallable)
 	void SetColors(FLinearColor Color, FLinearColor SelectedColor);
@@ -348,12 +494,38 @@ public:
 	UFUNCTION(BlueprintCallable, DisplayName = "Clear Offset Transforms")
 	void ClearVisualOffsets();
 
+	// Sets a run of offsets starting at StartIndex in one go. Prefer this over calling Set Offset Transform in a loop.
+	UFUNCTION(BlueprintCallable, DisplayName = "Set Offset Transforms")
+	void SetManipulatorVisualOffsets(TArray<FTransform> ManipulatorVisualOffsets, int32 StartIndex = 0);
+
+	// Copies the chosen sections of NewSettings onto this manipulator with a single change notification.
+	UFUNCTION(BlueprintCallable)
+	void ApplySettings(FManipulatorSettingsMain NewSettings, bool ApplyProperty = true, bool ApplyDraw = true, bool ApplyConstraints = true);
+
+	// Call after editing Settings or Preset Overrides directly from a Blueprint, cached draw data isn't rebuilt until this is called. The setters on this component and edits in the details panel do this for you.
+	UFUNCTION(BlueprintCallable)
+	void NotifySettingsChanged();
+
+	/** Changes whenever the settings are changed through a setter, the details panel, undo or NotifySettingsChanged, or the preset changes. Used to know when cached data is stale. */
+	uint32 GetSettingsVersion() const;
+
+	FOnManipulatorSettingsChanged OnSettingsChanged;
+
+	/** Every shape flattened into a single list in draw order. Only rebuilt when the settings version changes. */
+	const TArray<FManipulatorDrawShape>& GetDrawShapes();
+
 	UFUNCTION(BlueprintCallable)
 	FTransform CombineOffsetTransforms(TArray<FTransform> Offsets);
 
 	UFUNCTION(BlueprintCallable)
 	FString GetManipulatorID();
 
+	/** ID of a single array element, manipulators that don't drive the whole array always use their own index. */
+	FString GetManipulatorIDForIndex(int32 PropertyIndex) const;
+
+	/** True when this manipulator draws and edits every element of its array property. */
+	bool DrivesAllArrayElements() const;
+
 
 	// ========= WIRE BOX =========
 
@@ -367,6 +539,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ManipulatorTools|Shapes")
 	void SetShapeOfTypeWireBox(int32 Index, FManipulatorSettingsMainDrawWireBox WireBox);
 
+	// Replaces every shape of this type at once.
+	UFUNCTION(BlueprintCallable, Category = "ManipulatorTools|Shapes")
+	void SetAllShapesOfTypeWireBox(TArray<FManipulatorSettingsMainDrawWireBox> WireBoxes);
+
 
 	// ========= WIRE DIAMOND =========
 
@@ -379,6 +555,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ManipulatorTools|Shapes")
 	void SetShapeOfTypeWireDiamond(int32 Index, FManipulatorSettingsMainDrawWireDiamond WireDiamond);
 
+	// Replaces every shape of this type at once.
+	UFUNCTION(BlueprintCallable, Category = "ManipulatorTools|Shapes")
+	void SetAllShapesOfTypeWireDiamond(TArray<FManipulatorSettingsMainDrawWireDiamond> WireDiamonds);
+
 
 	// ========= CIRCLES =========
 
@@ -391,6 +571,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ManipulatorTools|Shapes")
 	void SetShapeOfTypeWireCircle(int32 Index, FManipulatorSettingsMainDrawCircle Circle);
 
+	// Replaces every shape of this type at once.
+	UFUNCTION(BlueprintCallable, Category = "ManipulatorTools|Shapes")
+	void SetAllShapesOfTypeWireCircle(TArray<FManipulatorSettingsMainDrawCircle> WireCircles);
+
 
 	// ========= PLANES =========
 
@@ -403,7 +587,36 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ManipulatorTools|Shapes")
 	void SetShapeOfTypePlane(int32 Index, FManipulatorSettingsMainDrawPlane Plane);
 
+	// Replaces every shape of this type at once.
+	UFUNCTION(BlueprintCallable, Category = "ManipulatorTools|Shapes")
+	void SetAllShapesOfTypePlane(TArray<FManipulatorSettingsMainDrawPlane> Planes);
+
 	virtual FTransform GetSocketTransform(FName InSocketName, ERelativeTransformSpace TransformSpace /* = RTS_World */) const override;
+	virtual void OnAttachmentChanged() override;
+
+	/**
+	 * Attach socket transforms relative to the owning actor for many manipulators at once, same as calling GetSocketTransform on each with RTS_Actor.
+	 * Manipulators on the same skeletal mesh share a single read of its bone buffer and each bone they use is only transformed once.
+	 */
+	static void GetAttachedSocketTransforms(const TArray<UManipulatorComponent*>& Manipulators, TArray<FTransform>& OutTransforms);
+
+	/**
+	 * Id generated the first time the manipulator is registered and saved with it. The construction script and Blueprint recompiles hand it on to the component
+	 * they recreate while duplicates get a new one, so it is what the manipulator mode remembers selections by.
+	 */
+	const FGuid& GetManipulatorGuid() const { return ManipulatorGuid; }
+
+	/** The live manipulator with the given id, null if none is registered. */
+	static UManipulatorComponent* FindManipulatorByGuid(const FGuid& Guid);
+
+	/** Takes over the id of the component this one replaces, used when the construction script reruns. */
+	void ApplyManipulatorGuid(const FGuid& Guid);
+
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	virtual void BeginDestroy() override;
+	virtual void PostDuplicate(bool bDuplicateForPIE) override;
+	virtual FActorComponentInstanceData* GetComponentInstanceData() const override;
 
 protected:
 	// Called when the game starts
@@ -420,6 +633,22 @@ public:
 	UFUNCTION(BlueprintCallable)
 	bool IsManipulatorSelected() const;
 
+	/** Called whenever the manipulator mode selects or deselects this manipulator so there is no need to poll Is Manipulator Selected. */
+	UPROPERTY(BlueprintAssignable)
+	FOnManipulatorSelectionChanged OnManipulatorSelectionChanged;
+
+	/** Used by the manipulator mode to update the selection state, a change is broadcast on the next Broadcast Selection Changes. */
+	void SetManipulatorSelected(bool bSelected);
+
+	/** Raises On Manipulator Selection Changed for every manipulator whose selection changed since the last call, the manipulator mode calls this from its tick. */
+	static void BroadcastSelectionChanges();
+
+	/** Hands every queued select and deselect request to the caller and empties the queue. */
+	static void TakeSelectionRequests(TArray<FManipulatorSelectionRequest>& OutRequests);
+
+	/** Queues a request, replacing any request still waiting for the same manipulator. */
+	static void QueueSelectionRequest(UManipulatorComponent* Component, bool bSelect);
+
 	/** Controlled by the manipulator mode while its active.*/
 	UPROPERTY(BlueprintReadOnly)
 	bool bIsManipulatorSelected = false;
@@ -434,6 +663,50 @@ public:
 	
 #if WITH_EDITOR
 	virtual bool CanEditChange(const UProperty* InProperty) const override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PostEditChangeChainProperty(FPropertyChangedChainEvent& PropertyChangedEvent) override;
+	virtual void PostEditUndo() override;
+	virtual void PostEditImport() override;
 #endif
 
+private:
+	UPROPERTY()
+	FGuid ManipulatorGuid;
+	/** Generates the id if there isn't one yet and adds this to the id lookup, replacing whatever had the id before. */
+	void RegisterManipulatorGuid();
+	/** Removes this from the id lookup unless something newer has taken the id over. */
+	void UnregisterManipulatorGuid();
+
+	/** Bumped by NotifySettingsChanged, the preset's own version is combined with it in GetSettingsVersion. */
+	uint32 SettingsVersion = 0;
+
+	/** Merged draw settings, only used while some but not all of the draw settings are overridden. */
+	mutable FManipulatorSettingsMainDraw ResolvedDraw;
+	mutable uint32 ResolvedDrawVersion = MAX_uint32;
+
+#if WITH_EDITOR
+	/** Resets sections that come from the preset back to defaults so only overrides get saved. */
+	void SyncSettingsWithPreset(FName ChangedOverride);
+#endif
+
+	void RebuildDrawShapes();
+	TArray<FManipulatorDrawShape> DrawShapes;
+	uint32 DrawShapesVersion = MAX_uint32;
+
+	/** Socket lookup for UseAttachedSocketAsInitialOffset, resolved once so evaluating the widget doesn't walk the attach chain and search sockets by name every time. */
+	bool IsSocketCacheValid(FName InSocketName) const;
+	void ResolveSocketCache(FName InSocketName) const;
+	const UObject* GetCachedSocketMeshAsset() const;
+	mutable bool bSocketCacheResolved = false;
+	mutable FName CachedSocketName = NAME_None;
+	mutable TWeakObjectPtr<const USceneComponent> CachedSocketAttachParent;
+	/** Top most component the socket is read from, plus the same component as a skinned or static mesh when it is one. */
+	mutable TWeakObjectPtr<const USceneComponent> CachedSocketParent;
+	mutable TWeakObjectPtr<const USkinnedMeshComponent> CachedSocketSkinnedMesh;
+	mutable TWeakObjectPtr<const UStaticMeshComponent> CachedSocketStaticMesh;
+	mutable TWeakObjectPtr<const UObject> CachedSocketMeshAsset;
+	mutable int32 CachedSocketBoneIndex = INDEX_NONE;
+	/** Socket relative to its bone, or to the component for static meshes. */
+	mutable FTransform CachedSocketLocalTransform = FTransform::Identity;
+
 };
@@ -0,0 +1,63 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Serialization/BulkData.h"
+#include "ManipulatorPoseLibrary.generated.h"
+
+class AActor;
+class UTexture2D;
+
+// Everything about a pose except its values, this is all that loads with the library.
+USTRUCT(BlueprintType)
+struct FManipulatorPoseLibraryEntry
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	FName Name;
+
+	/** Class the pose was captured from. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TSoftClassPtr<AActor> ActorClass;
+
+	/** Only loaded when something asks for it. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	TSoftObjectPtr<UTexture2D> Thumbnail;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 NumValues = 0;
+};
+
+/**
+ * Named manipulator poses for a class of actor.
+ * Each pose's values are stored as bulk data outside the export so opening the library only loads the entries,
+ * the values for a pose are read from disk when that pose is applied.
+ */
+UCLASS(BlueprintType)
+class MANIPULATORTOOLS_API UManipulatorPoseLibrary : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Serialize(FArchive& Ar) override;
+
+	const TArray<FManipulatorPoseLibraryEntry>& GetPoses() const { return Poses; }
+	int32 FindPoseIndex(FName PoseName) const;
+
+	/** Reads the values of a single pose, loading them from disk if they aren't resident. */
+	bool LoadPoseData(int32 PoseIndex, TArray<uint8>& OutData) const;
+
+	/** Adds a pose or replaces the values of the existing pose with the same name. Returns the pose index. */
+	int32 SetPoseData(FName PoseName, TSoftClassPtr<AActor> ActorClass, const TArray<uint8>& Data, int32 NumValues);
+	void RemovePose(int32 PoseIndex);
+
+private:
+	UPROPERTY(EditAnywhere, EditFixedSize)
+	TArray<FManipulatorPoseLibraryEntry> Poses;
+
+	/** One payload per entry in Poses. */
+	TIndirectArray<FByteBulkData> PoseData;
+};
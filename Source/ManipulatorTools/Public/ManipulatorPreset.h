@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "ManipulatorComponent.h"
+#include "ManipulatorPreset.generated.h"
+
+/**
+ * Draw and constraint settings shared by any number of manipulators.
+ * Manipulators pointing at a preset only store the parts they override, everything else is read from here.
+ */
+UCLASS(BlueprintType)
+class MANIPULATORTOOLS_API UManipulatorPreset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FManipulatorSettingsMainDraw Draw;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FManipulatorSettingsMainConstraints Constraints;
+
+	/** Bumped on every edit so manipulators using the preset know their resolved settings are stale. */
+	uint32 GetPresetVersion() const { return PresetVersion; }
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PostEditUndo() override;
+#endif
+
+private:
+	uint32 PresetVersion = 0;
+};
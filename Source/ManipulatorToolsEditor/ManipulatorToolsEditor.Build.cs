@@ -42,10 +42,12 @@ public class ManipulatorToolsEditor : ModuleRules
 				"InputCore",
 				"UnrealEd",
 				"LevelEditor",
+				"PropertyEditor",
                 "MovieScene",
                 //"MovieSceneTools",
                 "MovieSceneTracks",
                 "Sequencer",
+                "AssetRegistry",
 				"ManipulatorTools"
 
 				// ... add private dependencies that you statically link with here ...	
@@ -0,0 +1,361 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#include "ManipulatorAssetIndex.h"
+#include "ManipulatorDescriptors.h"
+#include "ManipulatorPreset.h"
+#include "AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
+#include "GameFramework/Actor.h"
+#include "UObject/UnrealType.h"
+#include "Misc/PackageName.h"
+
+const FName FManipulatorAssetIndex::CountTag(TEXT("ManipulatorCount"));
+const FName FManipulatorAssetIndex::PropertiesTag(TEXT("ManipulatorProperties"));
+const FName FManipulatorAssetIndex::PresetsTag(TEXT("ManipulatorPresets"));
+const FName FManipulatorAssetIndex::VersionTag(TEXT("ManipulatorTagVersion"));
+
+namespace
+{
+	/** Bump when the tag layout or what's gathered changes so older tags are treated as stale. */
+	const int32 ManipulatorTagVersion = 1;
+
+	FDelegateHandle GetExtraObjectTagsHandle;
+
+	const TCHAR* GetPropertyTypeTagName(EManipulatorPropertyType Type)
+	{
+		switch (Type)
+		{
+		case EManipulatorPropertyType::MT_VECTOR:
+			return TEXT("Vector");
+		case EManipulatorPropertyType::MT_ENUM:
+			return TEXT("Enum");
+		case EManipulatorPropertyType::MT_BOOL:
+			return TEXT("Bool");
+		default:
+			return TEXT("Transform");
+		}
+	}
+
+	const TCHAR* GetBindingSourceTagName(EManipulatorBindingSource Source)
+	{
+		switch (Source)
+		{
+		case EManipulatorBindingSource::Native:
+			return TEXT("Native");
+		case EManipulatorBindingSource::Blueprint:
+			return TEXT("Blueprint");
+		default:
+			return TEXT("Unresolved");
+		}
+	}
+
+	/**
+	 * Properties are written as Manipulator|NameToEdit|Type|Source separated by semicolons,
+	 * none of those characters can appear in a property path.
+	 */
+	bool ParseBindingTag(const FString& Entry, FManipulatorAssetBinding& OutBinding)
+	{
+		TArray<FString> Fields;
+		if (Entry.ParseIntoArray(Fields, TEXT("|"), false) != 4)
+		{
+			return false;
+		}
+
+		OutBinding.ManipulatorName = FName(*Fields[0]);
+		OutBinding.PropertyName = Fields[1];
+		OutBinding.Type = EManipulatorPropertyType::MT_TRANSFORM;
+		for (EManipulatorPropertyType Type : { EManipulatorPropertyType::MT_VECTOR, EManipulatorPropertyType::MT_ENUM, EManipulatorPropertyType::MT_BOOL })
+		{
+			if (Fields[2] == GetPropertyTypeTagName(Type))
+			{
+				OutBinding.Type = Type;
+			}
+		}
+		OutBinding.Source = EManipulatorBindingSource::Unresolved;
+		for (EManipulatorBindingSource Source : { EManipulatorBindingSource::Native, EManipulatorBindingSource::Blueprint })
+		{
+			if (Fields[3] == GetBindingSourceTagName(Source))
+			{
+				OutBinding.Source = Source;
+			}
+		}
+		return true;
+	}
+
+	UClass* GetNativeParentClass(UClass* Class)
+	{
+		while (Class != nullptr && Class->HasAnyClassFlags(CLASS_Native) == false)
+		{
+			Class = Class->GetSuperClass();
+		}
+		return Class;
+	}
+
+	void AddManipulatorBinding(const UBlueprint* Blueprint, FName ManipulatorName, const FManipulatorSettingsMainProperty& Property, TArray<FManipulatorAssetBinding>& OutBindings)
+	{
+		FManipulatorAssetBinding& Binding = OutBindings[OutBindings.AddDefaulted()];
+		Binding.ManipulatorName = ManipulatorName;
+		Binding.PropertyName = Property.NameToEdit;
+		Binding.Type = Property.Type;
+
+		UClass* GeneratedClass = Blueprint->GeneratedClass;
+		if (FManipulatorAssetIndex::CanBindProperty(GetNativeParentClass(GeneratedClass), Binding.PropertyName, Binding.Type))
+		{
+			Binding.Source = EManipulatorBindingSource::Native;
+		}
+		else if (FManipulatorAssetIndex::CanBindProperty(GeneratedClass, Binding.PropertyName, Binding.Type))
+		{
+			Binding.Source = EManipulatorBindingSource::Blueprint;
+		}
+	}
+
+	void GetBlueprintManipulatorTags(const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags)
+	{
+		const UBlueprint* Blueprint = Cast<UBlueprint>(Object);
+		if (Blueprint == nullptr || Blueprint->GeneratedClass == nullptr || Blueprint->GeneratedClass->IsChildOf(AActor::StaticClass()) == false)
+		{
+			return;
+		}
+
+		TArray<FManipulatorAssetBinding> Bindings;
+		TArray<FSoftObjectPath> Presets;
+		FManipulatorAssetIndex::GatherBlueprintManipulators(Blueprint, Bindings, Presets);
+
+		// Tagged even without manipulators so an empty blueprint doesn't read as stale and get loaded by deep checks.
+		FString Properties;
+		for (const FManipulatorAssetBinding& Binding : Bindings)
+		{
+			Properties += FString::Printf(TEXT("%s%s|%s|%s|%s"), Properties.IsEmpty() ? TEXT("") : TEXT(";"), *Binding.ManipulatorName.ToString(), *Binding.PropertyName, GetPropertyTypeTagName(Binding.Type), GetBindingSourceTagName(Binding.Source));
+		}
+		FString PresetPaths;
+		for (const FSoftObjectPath& Preset : Presets)
+		{
+			PresetPaths += (PresetPaths.IsEmpty() ? TEXT("") : TEXT(";")) + Preset.ToString();
+		}
+
+		OutTags.Add(UObject::FAssetRegistryTag(FManipulatorAssetIndex::CountTag, FString::FromInt(Bindings.Num()), UObject::FAssetRegistryTag::TT_Numerical));
+		OutTags.Add(UObject::FAssetRegistryTag(FManipulatorAssetIndex::PropertiesTag, Properties, UObject::FAssetRegistryTag::TT_Hidden));
+		OutTags.Add(UObject::FAssetRegistryTag(FManipulatorAssetIndex::PresetsTag, PresetPaths, UObject::FAssetRegistryTag::TT_Hidden));
+		OutTags.Add(UObject::FAssetRegistryTag(FManipulatorAssetIndex::VersionTag, FString::FromInt(ManipulatorTagVersion), UObject::FAssetRegistryTag::TT_Hidden));
+	}
+
+	void GetTaggedBlueprints(TArray<FAssetData>& OutAssets)
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetFName(), OutAssets, true);
+	}
+
+	template<typename PredicateType>
+	void FilterManipulatorBlueprints(TArray<FManipulatorAssetInfo>& OutInfos, PredicateType Predicate)
+	{
+		TArray<FAssetData> Assets;
+		GetTaggedBlueprints(Assets);
+		for (const FAssetData& Asset : Assets)
+		{
+			FManipulatorAssetInfo Info;
+			if (FManipulatorAssetIndex::GetAssetInfo(Asset, Info) && Predicate(Info))
+			{
+				OutInfos.Add(MoveTemp(Info));
+			}
+		}
+	}
+}
+
+void FManipulatorAssetIndex::Register()
+{
+	GetExtraObjectTagsHandle = UObject::FAssetRegistryTag::OnGetExtraObjectTags.AddStatic(&GetBlueprintManipulatorTags);
+}
+
+void FManipulatorAssetIndex::Unregister()
+{
+	UObject::FAssetRegistryTag::OnGetExtraObjectTags.Remove(GetExtraObjectTagsHandle);
+	GetExtraObjectTagsHandle.Reset();
+}
+
+bool FManipulatorAssetIndex::GetAssetInfo(const FAssetData& Asset, FManipulatorAssetInfo& OutInfo)
+{
+	OutInfo = FManipulatorAssetInfo();
+	OutInfo.Asset = Asset;
+	Asset.GetTagValue(FBlueprintTags::NativeParentClassPath, OutInfo.NativeParentClassPath);
+	OutInfo.NativeParentClassPath = FPackageName::ExportTextPathToObjectPath(OutInfo.NativeParentClassPath);
+
+	int32 Version = 0;
+	if (Asset.GetTagValue(VersionTag, Version) == false || Version != ManipulatorTagVersion)
+	{
+		// Only actor blueprints can have manipulators, anything else is safe to skip even without tags.
+		UClass* NativeParentClass = OutInfo.NativeParentClassPath.IsEmpty() ? nullptr : FindObject<UClass>(nullptr, *OutInfo.NativeParentClassPath);
+		return NativeParentClass == nullptr || NativeParentClass->IsChildOf(AActor::StaticClass());
+	}
+	OutInfo.bTagsCurrent = true;
+
+	Asset.GetTagValue(CountTag, OutInfo.NumManipulators);
+	if (OutInfo.NumManipulators == 0)
+	{
+		return false;
+	}
+
+	TArray<FString> Entries;
+	Asset.GetTagValueRef<FString>(PropertiesTag).ParseIntoArray(Entries, TEXT(";"));
+	for (const FString& Entry : Entries)
+	{
+		FManipulatorAssetBinding Binding;
+		if (ParseBindingTag(Entry, Binding))
+		{
+			OutInfo.Bindings.Add(Binding);
+		}
+	}
+
+	Asset.GetTagValueRef<FString>(PresetsTag).ParseIntoArray(Entries, TEXT(";"));
+	for (const FString& Entry : Entries)
+	{
+		OutInfo.Presets.Add(FSoftObjectPath(Entry));
+	}
+	return true;
+}
+
+void FManipulatorAssetIndex::FindManipulatorBlueprints(TArray<FManipulatorAssetInfo>& OutInfos, bool bWaitForScan)
+{
+	if (bWaitForScan)
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		AssetRegistry.SearchAllAssets(true);
+	}
+	FilterManipulatorBlueprints(OutInfos, [](const FManipulatorAssetInfo&) { return true; });
+}
+
+void FManipulatorAssetIndex::FindBlueprintsDrivingProperty(const FString& PropertyName, TArray<FManipulatorAssetInfo>& OutInfos)
+{
+	FilterManipulatorBlueprints(OutInfos, [&PropertyName](const FManipulatorAssetInfo& Info)
+	{
+		return Info.Bindings.ContainsByPredicate([&PropertyName](const FManipulatorAssetBinding& Binding) { return Binding.PropertyName == PropertyName; });
+	});
+}
+
+void FManipulatorAssetIndex::FindBlueprintsUsingPreset(const FSoftObjectPath& Preset, TArray<FManipulatorAssetInfo>& OutInfos)
+{
+	FilterManipulatorBlueprints(OutInfos, [&Preset](const FManipulatorAssetInfo& Info)
+	{
+		return Info.Presets.Contains(Preset);
+	});
+}
+
+void FManipulatorAssetIndex::GatherBlueprintManipulators(const UBlueprint* Blueprint, TArray<FManipulatorAssetBinding>& OutBindings, TArray<FSoftObjectPath>& OutPresets)
+{
+	UClass* GeneratedClass = Blueprint->GeneratedClass;
+	if (GeneratedClass == nullptr)
+	{
+		return;
+	}
+
+	const auto AddPreset = [&OutPresets](const FSoftObjectPath& Preset)
+	{
+		if (Preset.IsNull() == false)
+		{
+			OutPresets.AddUnique(Preset);
+		}
+	};
+
+	// Components inherited from native parents live on the default object, components added in blueprints only exist as construction script templates.
+	if (AActor* DefaultActor = Cast<AActor>(GeneratedClass->GetDefaultObject(false)))
+	{
+		TInlineComponentArray<UManipulatorComponent*> NativeManipulators;
+		DefaultActor->GetComponents(NativeManipulators);
+		for (UManipulatorComponent* Manipulator : NativeManipulators)
+		{
+			AddManipulatorBinding(Blueprint, Manipulator->GetFName(), Manipulator->Settings.Property, OutBindings);
+			AddPreset(Manipulator->Preset);
+		}
+	}
+
+	// Parent blueprints' construction scripts add their components too, GetActualComponentTemplate picks up any override a child class made to them.
+	UBlueprintGeneratedClass* ActualClass = Cast<UBlueprintGeneratedClass>(GeneratedClass);
+	for (UBlueprintGeneratedClass* Class = ActualClass; Class != nullptr; Class = Cast<UBlueprintGeneratedClass>(Class->GetSuperClass()))
+	{
+		if (Class->SimpleConstructionScript == nullptr)
+		{
+			continue;
+		}
+		for (USCS_Node* Node : Class->SimpleConstructionScript->GetAllNodes())
+		{
+			if (UManipulatorComponent* Manipulator = Node ? Cast<UManipulatorComponent>(Node->GetActualComponentTemplate(ActualClass)) : nullptr)
+			{
+				AddManipulatorBinding(Blueprint, Node->GetVariableName(), Manipulator->Settings.Property, OutBindings);
+				AddPreset(Manipulator->Preset);
+			}
+		}
+	}
+
+	for (const FManipulatorDescriptor& Descriptor : FManipulatorDescriptors::GetClassDescriptors(GeneratedClass))
+	{
+		AddManipulatorBinding(Blueprint, Descriptor.Name, Descriptor.Property, OutBindings);
+		AddPreset(Descriptor.Preset);
+	}
+}
+
+bool FManipulatorAssetIndex::CanBindProperty(const UStruct* Struct, const FString& PropertyName, EManipulatorPropertyType Type)
+{
+	if (Struct == nullptr || PropertyName.IsEmpty())
+	{
+		return false;
+	}
+
+	// Same path rules as the mode uses when editing, struct members separated by dots with optional array indices.
+	TArray<FString> Tokens;
+	PropertyName.ParseIntoArray(Tokens, TEXT("."));
+	UProperty* Property = nullptr;
+	for (int32 TokenIndex = 0; TokenIndex < Tokens.Num(); TokenIndex++)
+	{
+		FString NameToken = Tokens[TokenIndex];
+		const int32 ArrayPos = NameToken.Find(TEXT("["));
+		if (ArrayPos != INDEX_NONE)
+		{
+			NameToken = NameToken.Left(ArrayPos);
+		}
+
+		Property = FindField<UProperty>(Struct, FName(*NameToken));
+		if (Property == nullptr)
+		{
+			return false;
+		}
+		if (TokenIndex == Tokens.Num() - 1)
+		{
+			break;
+		}
+
+		UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property);
+		UStructProperty* StructProperty = Cast<UStructProperty>(ArrayProperty ? ArrayProperty->Inner : Property);
+		if (StructProperty == nullptr)
+		{
+			return false;
+		}
+		Struct = StructProperty->Struct;
+	}
+
+	if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
+	{
+		Property = ArrayProperty->Inner;
+	}
+
+	switch (Type)
+	{
+	case EManipulatorPropertyType::MT_TRANSFORM:
+	case EManipulatorPropertyType::MT_VECTOR:
+	{
+		UStructProperty* StructProperty = Cast<UStructProperty>(Property);
+		return StructProperty != nullptr && StructProperty->Struct == (Type == EManipulatorPropertyType::MT_TRANSFORM ? TBaseStructure<FTransform>::Get() : TBaseStructure<FVector>::Get());
+	}
+	case EManipulatorPropertyType::MT_ENUM:
+		return Property->IsA<UByteProperty>() || Property->IsA<UEnumProperty>();
+	case EManipulatorPropertyType::MT_BOOL:
+	{
+		// The mode reads and writes bools through a plain bool pointer so bitfields can't be bound.
+		UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property);
+		return BoolProperty != nullptr && BoolProperty->IsNativeBool();
+	}
+	default:
+		return false;
+	}
+}
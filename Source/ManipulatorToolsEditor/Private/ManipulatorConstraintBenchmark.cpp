@@ -0,0 +1,71 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#include "ManipulatorComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogManipulatorConstraintBenchmark, Log, All);
+
+namespace
+{
+	/** Times the vectorized constraint path against the scalar one on the same transforms and checks they agree. */
+	void BenchmarkConstrainTransforms(const TArray<FString>& Args)
+	{
+		const int32 NumTransforms = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100000;
+		const int32 NumRuns = 10;
+
+		UManipulatorComponent* Manipulator = NewObject<UManipulatorComponent>(GetTransientPackage(), NAME_None, RF_Transient);
+		Manipulator->Settings.Property.Type = EManipulatorPropertyType::MT_TRANSFORM;
+		Manipulator->Settings.Constraints.UseLocationConstraint = true;
+		Manipulator->Settings.Constraints.UseScaleConstraint = true;
+
+		// Spread well past the default bounds so about half of every component gets clamped.
+		FRandomStream Random(NumTransforms);
+		TArray<FTransform> Source;
+		Source.Reserve(NumTransforms);
+		for (int32 Index = 0; Index < NumTransforms; Index++)
+		{
+			Source.Add(FTransform(FRotator(Random.FRandRange(-180.0f, 180.0f), Random.FRandRange(-180.0f, 180.0f), 0.0f).Quaternion(),
+				FVector(Random.FRandRange(-10.0f, 10.0f), Random.FRandRange(-10.0f, 10.0f), Random.FRandRange(-10.0f, 10.0f)),
+				FVector(Random.FRandRange(-1.0f, 4.0f), Random.FRandRange(-1.0f, 4.0f), Random.FRandRange(-1.0f, 4.0f))));
+		}
+
+		const auto TimeBestRun = [&Source, NumRuns](TArray<FTransform>& Transforms, TFunctionRef<void(TArrayView<FTransform>)> Constrain)
+		{
+			double BestSeconds = MAX_dbl;
+			for (int32 Run = 0; Run < NumRuns; Run++)
+			{
+				Transforms = Source;
+				const double StartSeconds = FPlatformTime::Seconds();
+				Constrain(Transforms);
+				BestSeconds = FMath::Min(BestSeconds, FPlatformTime::Seconds() - StartSeconds);
+			}
+			return BestSeconds * 1000.0;
+		};
+
+		TArray<FTransform> Vectorized;
+		TArray<FTransform> Scalar;
+		const double VectorizedMilliseconds = TimeBestRun(Vectorized, [Manipulator](TArrayView<FTransform> Transforms) { Manipulator->ConstrainTransformsInPlace(Transforms); });
+		const double ScalarMilliseconds = TimeBestRun(Scalar, [Manipulator](TArrayView<FTransform> Transforms) { Manipulator->ConstrainTransformsInPlaceScalar(Transforms); });
+
+		int32 NumMismatches = 0;
+		for (int32 Index = 0; Index < NumTransforms; Index++)
+		{
+			if (Vectorized[Index].Equals(Scalar[Index], 0.0f) == false)
+			{
+				NumMismatches++;
+			}
+		}
+
+		UE_LOG(LogManipulatorConstraintBenchmark, Display, TEXT("Constrained %d transforms, best of %d runs: vectorized %.3f ms, scalar %.3f ms (%.2fx), %d results differ."),
+			NumTransforms, NumRuns, VectorizedMilliseconds, ScalarMilliseconds, VectorizedMilliseconds > 0.0 ? ScalarMilliseconds / VectorizedMilliseconds : 0.0, NumMismatches);
+		Manipulator->MarkPendingKill();
+	}
+
+	FAutoConsoleCommand BenchmarkConstrainTransformsCommand(
+		TEXT("ManipulatorTools.BenchmarkConstrainTransforms"),
+		TEXT("Times clamping transforms to manipulator constraints, vectorized against scalar. Takes an optional transform count, defaults to 100000."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkConstrainTransforms));
+}
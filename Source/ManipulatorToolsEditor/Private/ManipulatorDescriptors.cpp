@@ -0,0 +1,301 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#include "ManipulatorDescriptors.h"
+#include "ManipulatorPreset.h"
+#include "GameFramework/Actor.h"
+#include "Misc/SecureHash.h"
+#include "UObject/UnrealType.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	const FName ManipulatorMetaName(TEXT("Manipulator"));
+	const FName ManipulatorPresetMetaName(TEXT("ManipulatorPreset"));
+	const FName ManipulatorMirrorMetaName(TEXT("ManipulatorMirror"));
+	const FName ManipulatorStepSizeMetaName(TEXT("ManipulatorStepSize"));
+	const FName ManipulatorDirectionMetaName(TEXT("ManipulatorDirection"));
+
+	TMap<TWeakObjectPtr<UClass>, TArray<FManipulatorDescriptor>> ClassDescriptors;
+
+	/** Declared manipulator handles of the actors the mode has looked at, kept so their ids are only worked out once. */
+	TMap<TWeakObjectPtr<AActor>, TArray<FManipulatorHandle>> ActorManipulators;
+
+	/** The same handles by id. */
+	TMap<FGuid, FManipulatorHandle> DeclaredManipulatorsByGuid;
+
+	/** Declared manipulators have no component to keep an id on, the actor isn't recreated with its construction script though so its path and the property name identify them. */
+	FGuid MakeDeclaredGuid(const AActor* Actor, FName Name)
+	{
+		const FString Key = Actor->GetPathName() + TEXT(".") + Name.ToString();
+		FMD5 Hash;
+		Hash.Update((const uint8*)*Key, Key.Len() * sizeof(TCHAR));
+		uint32 Digest[4];
+		Hash.Final((uint8*)Digest);
+		return FGuid(Digest[0], Digest[1], Digest[2], Digest[3]);
+	}
+
+	void ForgetActorManipulators(const TArray<FManipulatorHandle>& Manipulators)
+	{
+		for (const FManipulatorHandle& Manipulator : Manipulators)
+		{
+			DeclaredManipulatorsByGuid.Remove(Manipulator.Guid);
+		}
+	}
+
+	/** Works out the manipulator type of a property, returns false if manipulators can't edit it. */
+	bool GetDescriptorPropertyType(UProperty* Property, FManipulatorSettingsMainProperty& OutProperty)
+	{
+		UProperty* ValueProperty = Property;
+		bool bIsArray = false;
+		if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
+		{
+			ValueProperty = ArrayProperty->Inner;
+			bIsArray = true;
+		}
+
+		if (UStructProperty* StructProperty = Cast<UStructProperty>(ValueProperty))
+		{
+			if (StructProperty->Struct == TBaseStructure<FTransform>::Get())
+			{
+				OutProperty.Type = EManipulatorPropertyType::MT_TRANSFORM;
+			}
+			else if (StructProperty->Struct == TBaseStructure<FVector>::Get())
+			{
+				OutProperty.Type = EManipulatorPropertyType::MT_VECTOR;
+			}
+			else
+			{
+				return false;
+			}
+			OutProperty.UseAllArrayElements = bIsArray;
+			return true;
+		}
+
+		// Enums and bools are edited one value at a time so arrays of them aren't supported.
+		if (bIsArray)
+		{
+			return false;
+		}
+
+		UEnum* Enum = nullptr;
+		if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(ValueProperty))
+		{
+			if (EnumProperty->GetUnderlyingProperty()->ElementSize != sizeof(uint8))
+			{
+				return false;
+			}
+			Enum = EnumProperty->GetEnum();
+		}
+		else if (UByteProperty* ByteProperty = Cast<UByteProperty>(ValueProperty))
+		{
+			Enum = ByteProperty->Enum;
+		}
+		if (Enum != nullptr)
+		{
+			OutProperty.Type = EManipulatorPropertyType::MT_ENUM;
+			OutProperty.EnumSettings.EnumSize = uint8(Enum->NumEnums() - (Enum->ContainsExistingMax() ? 1 : 0));
+			return true;
+		}
+
+		// Bitfield bools don't own a whole byte so they can't be written through a bool pointer.
+		UBoolProperty* BoolProperty = Cast<UBoolProperty>(ValueProperty);
+		if (BoolProperty != nullptr && BoolProperty->IsNativeBool())
+		{
+			OutProperty.Type = EManipulatorPropertyType::MT_BOOL;
+			return true;
+		}
+		return false;
+	}
+
+	void ScanClassDescriptors(UClass* Class, TArray<FManipulatorDescriptor>& OutDescriptors)
+	{
+#if WITH_METADATA
+		for (TFieldIterator<UProperty> It(Class, EFieldIteratorFlags::IncludeSuper); It; ++It)
+		{
+			UProperty* Property = *It;
+			if (Property->HasMetaData(ManipulatorMetaName) == false)
+			{
+				continue;
+			}
+
+			FManipulatorDescriptor Descriptor;
+			if (GetDescriptorPropertyType(Property, Descriptor.Property) == false)
+			{
+				continue;
+			}
+			Descriptor.Name = Property->GetFName();
+			Descriptor.Property.NameToEdit = Property->GetName();
+			Descriptor.Property.Index = 0;
+
+			if (Property->HasMetaData(ManipulatorPresetMetaName))
+			{
+				Descriptor.Preset = FSoftObjectPath(Property->GetMetaData(ManipulatorPresetMetaName));
+			}
+			if (Property->HasMetaData(ManipulatorMirrorMetaName))
+			{
+				Descriptor.Property.MirrorPartner = FName(*Property->GetMetaData(ManipulatorMirrorMetaName));
+			}
+			if (Property->HasMetaData(ManipulatorStepSizeMetaName))
+			{
+				Descriptor.Property.EnumSettings.StepSize = FCString::Atof(*Property->GetMetaData(ManipulatorStepSizeMetaName));
+			}
+			if (Property->HasMetaData(ManipulatorDirectionMetaName))
+			{
+				const FString& Direction = Property->GetMetaData(ManipulatorDirectionMetaName);
+				if (Direction == TEXT("Y"))
+				{
+					Descriptor.Property.EnumSettings.Direction = EManipulatorPropertyEnumDirection::MT_Y;
+				}
+				else if (Direction == TEXT("Z"))
+				{
+					Descriptor.Property.EnumSettings.Direction = EManipulatorPropertyEnumDirection::MT_Z;
+				}
+			}
+			OutDescriptors.Add(MoveTemp(Descriptor));
+		}
+#endif
+	}
+}
+
+UManipulatorPreset* FManipulatorDescriptor::GetPreset() const
+{
+	// Only tries again if a preset that did load has since been garbage collected, a path that doesn't load is only tried once.
+	if (bPresetResolved == false || LoadedPreset.IsStale())
+	{
+		LoadedPreset = Preset.IsNull() ? nullptr : Cast<UManipulatorPreset>(Preset.TryLoad());
+		bPresetResolved = true;
+	}
+	return LoadedPreset.Get();
+}
+
+UManipulatorComponent* FManipulatorDescriptor::GetSharedSettings() const
+{
+	if (SharedSettings.IsValid() == false)
+	{
+		// Never registered or attached, it only carries the settings the mode reads.
+		UManipulatorComponent* Settings = NewObject<UManipulatorComponent>(GetTransientPackage(), NAME_None, RF_Transient);
+		Settings->Settings.Property = Property;
+		Settings->Preset = GetPreset();
+		SharedSettings.Reset(Settings);
+	}
+	return SharedSettings.Get();
+}
+
+FManipulatorHandle::FManipulatorHandle(UManipulatorComponent* InComponent)
+	: Component(InComponent)
+	, Actor(InComponent ? InComponent->GetOwner() : nullptr)
+	, Guid(InComponent ? InComponent->GetManipulatorGuid() : FGuid())
+{
+}
+
+FName FManipulatorHandle::GetName() const
+{
+	if (IsDeclared())
+	{
+		return DeclaredName;
+	}
+	const UManipulatorComponent* ManipulatorComponent = GetComponent();
+	return ManipulatorComponent ? ManipulatorComponent->GetFName() : NAME_None;
+}
+
+FString FManipulatorHandle::GetID(int32 PropertyIndex) const
+{
+	const UManipulatorComponent* ManipulatorComponent = GetComponent();
+	const AActor* ManipulatorActor = GetActor();
+	if (ManipulatorComponent == nullptr || ManipulatorActor == nullptr)
+	{
+		return FString();
+	}
+	if (ManipulatorComponent->DrivesAllArrayElements() == false)
+	{
+		PropertyIndex = ManipulatorComponent->Settings.Property.Index;
+	}
+	return ManipulatorActor->GetName() + "_" + GetName().ToString() + "_" + ManipulatorComponent->Settings.Property.NameToEdit + "_" + FString::FromInt(PropertyIndex);
+}
+
+const TArray<FManipulatorDescriptor>& FManipulatorDescriptors::GetClassDescriptors(UClass* Class)
+{
+	if (const TArray<FManipulatorDescriptor>* Descriptors = ClassDescriptors.Find(Class))
+	{
+		return *Descriptors;
+	}
+
+	TArray<FManipulatorDescriptor>& Descriptors = ClassDescriptors.Add(Class);
+	ScanClassDescriptors(Class, Descriptors);
+	return Descriptors;
+}
+
+void FManipulatorDescriptors::GetActorManipulators(AActor* Actor, TArray<FManipulatorHandle>& OutManipulators)
+{
+	OutManipulators.Reset();
+	if (IsValid(Actor) == false)
+	{
+		return;
+	}
+
+	TInlineComponentArray<UManipulatorComponent*> Components(Actor);
+	for (UManipulatorComponent* ManipulatorComponent : Components)
+	{
+		OutManipulators.Emplace(ManipulatorComponent);
+	}
+
+	const TArray<FManipulatorDescriptor>& Descriptors = GetClassDescriptors(Actor->GetClass());
+	if (Descriptors.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FManipulatorHandle>* Declared = ActorManipulators.Find(Actor);
+	if (Declared == nullptr)
+	{
+		Declared = &ActorManipulators.Add(Actor);
+		Declared->Reserve(Descriptors.Num());
+		for (const FManipulatorDescriptor& Descriptor : Descriptors)
+		{
+			FManipulatorHandle& Manipulator = (*Declared)[Declared->AddDefaulted()];
+			Manipulator.Component = Descriptor.GetSharedSettings();
+			Manipulator.Actor = Actor;
+			Manipulator.DeclaredName = Descriptor.Name;
+			Manipulator.Guid = MakeDeclaredGuid(Actor, Descriptor.Name);
+			DeclaredManipulatorsByGuid.Add(Manipulator.Guid, Manipulator);
+		}
+	}
+	OutManipulators.Append(*Declared);
+}
+
+bool FManipulatorDescriptors::FindManipulator(const FGuid& Guid, FManipulatorHandle& OutManipulator)
+{
+	if (UManipulatorComponent* ManipulatorComponent = UManipulatorComponent::FindManipulatorByGuid(Guid))
+	{
+		OutManipulator = FManipulatorHandle(ManipulatorComponent);
+		return OutManipulator.IsValid();
+	}
+
+	const FManipulatorHandle* Declared = DeclaredManipulatorsByGuid.Find(Guid);
+	if (Declared != nullptr && Declared->IsValid())
+	{
+		OutManipulator = *Declared;
+		return true;
+	}
+	return false;
+}
+
+void FManipulatorDescriptors::Prune()
+{
+	for (auto It = ActorManipulators.CreateIterator(); It; ++It)
+	{
+		AActor* Actor = It.Key().Get();
+		if (IsValid(Actor) == false || Actor->IsSelected() == false)
+		{
+			ForgetActorManipulators(It.Value());
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FManipulatorDescriptors::Reset()
+{
+	ActorManipulators.Empty();
+	DeclaredManipulatorsByGuid.Empty();
+	ClassDescriptors.Empty();
+}
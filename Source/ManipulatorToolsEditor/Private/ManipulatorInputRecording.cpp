@@ -0,0 +1,247 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#include "ManipulatorInputRecording.h"
+#include "ManipulatorToolsEditorEdMode.h"
+#include "ManipulatorPoseSnapshot.h"
+#include "GameFramework/Actor.h"
+#include "EditorModeManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogManipulatorInput, Log, All);
+
+namespace
+{
+	const uint32 InputRecordingMagic = 0x4D495252;
+	const int32 InputRecordingVersion = 1;
+
+	AActor* FindRecordedActor(const FString& ActorPath)
+	{
+		AActor* Actor = FindObject<AActor>(nullptr, *ActorPath);
+		return IsValid(Actor) ? Actor : nullptr;
+	}
+
+	double GetSortedPercentile(const TArray<double>& Sorted, double Fraction)
+	{
+		return Sorted.Num() > 0 ? Sorted[FMath::Clamp(FMath::CeilToInt(Fraction * Sorted.Num()) - 1, 0, Sorted.Num() - 1)] : 0.0;
+	}
+
+	FAutoConsoleCommand StartInputRecordingCommand(
+		TEXT("ManipulatorTools.Input.StartRecording"),
+		TEXT("Starts recording clicks and drags in the manipulator mode, activating the mode if needed."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			if (FManipulatorToolsEditorEdMode* Mode = FManipulatorInputReplay::ActivateManipulatorMode())
+			{
+				Mode->StartInputRecording();
+				UE_LOG(LogManipulatorInput, Display, TEXT("Recording manipulator input."));
+			}
+		}));
+
+	FAutoConsoleCommand StopInputRecordingCommand(
+		TEXT("ManipulatorTools.Input.StopRecording"),
+		TEXT("Stops recording manipulator input and saves it. Takes an optional file name, defaults to one in the profiling directory."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			FManipulatorToolsEditorEdMode* Mode = static_cast<FManipulatorToolsEditorEdMode*>(GLevelEditorModeTools().GetActiveMode(FManipulatorToolsEditorEdMode::EM_ManipulatorToolsEditorEdModeId));
+			FManipulatorInputRecording Recording;
+			if (Mode == nullptr || Mode->StopInputRecording(Recording) == false)
+			{
+				UE_LOG(LogManipulatorInput, Warning, TEXT("Manipulator input isn't being recorded."));
+				return;
+			}
+
+			const FString Filename = Args.Num() > 0 ? Args[0] : FPaths::ProfilingDir() / FString::Printf(TEXT("ManipulatorInput-%s.bin"), *FDateTime::Now().ToString());
+			if (Recording.SaveToFile(Filename))
+			{
+				UE_LOG(LogManipulatorInput, Display, TEXT("Saved %d manipulator input events to %s"), Recording.Events.Num(), *Filename);
+			}
+			else
+			{
+				UE_LOG(LogManipulatorInput, Warning, TEXT("Couldn't save manipulator input to %s"), *Filename);
+			}
+		}));
+
+	FAutoConsoleCommand ReplayInputCommand(
+		TEXT("ManipulatorTools.Input.Replay"),
+		TEXT("Replays a manipulator input recording against the open level and checks the values it ends on."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			FManipulatorInputRecording Recording;
+			if (Args.Num() == 0 || Recording.LoadFromFile(Args[0]) == false)
+			{
+				UE_LOG(LogManipulatorInput, Warning, TEXT("Usage: ManipulatorTools.Input.Replay File"));
+				return;
+			}
+			if (FManipulatorToolsEditorEdMode* Mode = FManipulatorInputReplay::ActivateManipulatorMode())
+			{
+				const FManipulatorInputReplayResult Result = FManipulatorInputReplay::Replay(*Mode, Recording);
+				UE_LOG(LogManipulatorInput, Display, TEXT("%s"), *Result.ToString());
+			}
+		}));
+}
+
+FArchive& operator<<(FArchive& Ar, FManipulatorInputEvent& Event)
+{
+	uint8 Type = (uint8)Event.Type;
+	Ar << Type;
+	Event.Type = (EManipulatorInputEventType)Type;
+	Ar << Event.Seconds;
+
+	switch (Event.Type)
+	{
+	case EManipulatorInputEventType::SelectActors:
+		Ar << Event.Actors;
+		break;
+	case EManipulatorInputEventType::Click:
+		Ar << Event.Target << Event.bControlDown << Event.bShiftDown;
+		break;
+	case EManipulatorInputEventType::BeginDrag:
+		Ar << Event.Axis << Event.Selection;
+		break;
+	case EManipulatorInputEventType::Delta:
+		Ar << Event.Axis << Event.Drag << Event.Rot << Event.Scale;
+		break;
+	default:
+		break;
+	}
+	return Ar;
+}
+
+void FManipulatorInputRecording::AddActor(AActor* Actor)
+{
+	const FString ActorPath = Actor->GetPathName();
+	for (const FManipulatorInputRecordedActor& RecordedActor : RecordedActors)
+	{
+		if (RecordedActor.ActorPath == ActorPath)
+		{
+			return;
+		}
+	}
+
+	FManipulatorInputRecordedActor& RecordedActor = RecordedActors[RecordedActors.AddDefaulted()];
+	RecordedActor.ActorPath = ActorPath;
+	RecordedActor.InitialPose = FManipulatorPoseSnapshot::Capture({ Actor }).GetData();
+}
+
+void FManipulatorInputRecording::CaptureFinalPoses()
+{
+	for (FManipulatorInputRecordedActor& RecordedActor : RecordedActors)
+	{
+		if (AActor* Actor = FindRecordedActor(RecordedActor.ActorPath))
+		{
+			RecordedActor.FinalPose = FManipulatorPoseSnapshot::Capture({ Actor }).GetData();
+		}
+	}
+}
+
+bool FManipulatorInputRecording::SaveToFile(const FString& Filename)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	uint32 Magic = InputRecordingMagic;
+	int32 Version = InputRecordingVersion;
+	Writer << Magic << Version;
+	Writer << MapName << RecordedActors << Events;
+	return FFileHelper::SaveArrayToFile(Bytes, *Filename);
+}
+
+bool FManipulatorInputRecording::LoadFromFile(const FString& Filename)
+{
+	TArray<uint8> Bytes;
+	if (FFileHelper::LoadFileToArray(Bytes, *Filename) == false)
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	uint32 Magic = 0;
+	int32 Version = 0;
+	Reader << Magic << Version;
+	if (Magic != InputRecordingMagic || Version != InputRecordingVersion)
+	{
+		return false;
+	}
+	Reader << MapName << RecordedActors << Events;
+	return Reader.IsError() == false;
+}
+
+FString FManipulatorInputReplayResult::ToString() const
+{
+	FString Report = FString::Printf(TEXT("Replayed %d events (%d deltas) in %.3f ms, delta p50 %.3f ms, p95 %.3f ms, max %.3f ms."),
+		NumEvents, NumDeltas, TotalMilliseconds, DeltaP50Milliseconds, DeltaP95Milliseconds, DeltaMaxMilliseconds);
+	for (const FString& ActorPath : MissingActors)
+	{
+		Report += FString::Printf(TEXT("\n  Missing actor %s"), *ActorPath);
+	}
+	for (const FString& ActorPath : MismatchedActors)
+	{
+		Report += FString::Printf(TEXT("\n  Values differ from the recording on %s"), *ActorPath);
+	}
+	Report += Succeeded() ? TEXT("\nFinal values match the recording.") : TEXT("\nFinal values don't match the recording.");
+	return Report;
+}
+
+FManipulatorInputReplayResult FManipulatorInputReplay::Replay(FManipulatorToolsEditorEdMode& Mode, const FManipulatorInputRecording& Recording)
+{
+	FManipulatorInputReplayResult Result;
+
+	// Start from the values the recording started from rather than whatever the level has now.
+	TArray<AActor*> Actors;
+	for (const FManipulatorInputRecordedActor& RecordedActor : Recording.RecordedActors)
+	{
+		AActor* Actor = FindRecordedActor(RecordedActor.ActorPath);
+		if (Actor == nullptr)
+		{
+			Result.MissingActors.Add(RecordedActor.ActorPath);
+			Actors.Add(nullptr);
+			continue;
+		}
+		FManipulatorPoseSnapshot::FromData(RecordedActor.InitialPose).Apply({ Actor });
+		Actors.Add(Actor);
+	}
+
+	TArray<double> DeltaMilliseconds;
+	const uint64 ReplayStartCycles = FPlatformTime::Cycles64();
+	for (const FManipulatorInputEvent& Event : Recording.Events)
+	{
+		const uint64 EventStartCycles = FPlatformTime::Cycles64();
+		Mode.ReplayInputEvent(Event);
+		if (Event.Type == EManipulatorInputEventType::Delta)
+		{
+			DeltaMilliseconds.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - EventStartCycles));
+		}
+	}
+	Result.TotalMilliseconds = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ReplayStartCycles);
+	Result.NumEvents = Recording.Events.Num();
+	Result.NumDeltas = DeltaMilliseconds.Num();
+
+	DeltaMilliseconds.Sort();
+	Result.DeltaP50Milliseconds = GetSortedPercentile(DeltaMilliseconds, 0.50);
+	Result.DeltaP95Milliseconds = GetSortedPercentile(DeltaMilliseconds, 0.95);
+	Result.DeltaMaxMilliseconds = DeltaMilliseconds.Num() > 0 ? DeltaMilliseconds.Last() : 0.0;
+
+	// Snapshots hold the raw value bytes so an exact compare means every value came out bit identical.
+	for (int32 ActorIndex = 0; ActorIndex < Actors.Num(); ActorIndex++)
+	{
+		if (Actors[ActorIndex] != nullptr && FManipulatorPoseSnapshot::Capture({ Actors[ActorIndex] }).GetData() != Recording.RecordedActors[ActorIndex].FinalPose)
+		{
+			Result.MismatchedActors.Add(Recording.RecordedActors[ActorIndex].ActorPath);
+		}
+	}
+	return Result;
+}
+
+FManipulatorToolsEditorEdMode* FManipulatorInputReplay::ActivateManipulatorMode()
+{
+	if (GLevelEditorModeTools().IsModeActive(FManipulatorToolsEditorEdMode::EM_ManipulatorToolsEditorEdModeId) == false)
+	{
+		GLevelEditorModeTools().ActivateMode(FManipulatorToolsEditorEdMode::EM_ManipulatorToolsEditorEdModeId);
+	}
+	return static_cast<FManipulatorToolsEditorEdMode*>(GLevelEditorModeTools().GetActiveMode(FManipulatorToolsEditorEdMode::EM_ManipulatorToolsEditorEdModeId));
+}
@@ -0,0 +1,74 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#include "ManipulatorInputReplayCommandlet.h"
+#include "ManipulatorInputRecording.h"
+#include "ManipulatorToolsEditorEdMode.h"
+#include "Editor.h"
+#include "EditorModeManager.h"
+#include "Engine/World.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogManipulatorInputReplay, Log, All);
+
+UManipulatorInputReplayCommandlet::UManipulatorInputReplayCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UManipulatorInputReplayCommandlet::Main(const FString& Params)
+{
+	FString RecordingFile;
+	FManipulatorInputRecording Recording;
+	if (FParse::Value(*Params, TEXT("Recording="), RecordingFile) == false || Recording.LoadFromFile(RecordingFile) == false)
+	{
+		UE_LOG(LogManipulatorInputReplay, Error, TEXT("Usage: -run=ManipulatorInputReplay -Recording=File [-Map=Package]"));
+		return 1;
+	}
+
+	FString MapName = Recording.MapName;
+	FParse::Value(*Params, TEXT("Map="), MapName);
+	UPackage* MapPackage = LoadPackage(nullptr, *MapName, LOAD_None);
+	UWorld* World = MapPackage ? UWorld::FindWorldInPackage(MapPackage) : nullptr;
+	if (World == nullptr)
+	{
+		UE_LOG(LogManipulatorInputReplay, Error, TEXT("Couldn't load the level %s"), *MapName);
+		return 1;
+	}
+
+	// Manipulators are found by ids registered when their components register, so the level needs to be set up like it would be in the editor.
+	World->AddToRoot();
+	World->WorldType = EWorldType::Editor;
+	if (World->bIsWorldInitialized == false)
+	{
+		World->InitWorld(UWorld::InitializationValues()
+			.AllowAudioPlayback(false)
+			.CreatePhysicsScene(false)
+			.RequiresHitProxies(false)
+			.CreateNavigation(false)
+			.CreateAISystem(false)
+			.ShouldSimulatePhysics(false)
+			.SetTransactional(false));
+	}
+	World->UpdateWorldComponents(true, false);
+	GEditor->GetEditorWorldContext().SetCurrentWorld(World);
+
+	int32 ReturnCode = 1;
+	if (FManipulatorToolsEditorEdMode* Mode = FManipulatorInputReplay::ActivateManipulatorMode())
+	{
+		const FManipulatorInputReplayResult Result = FManipulatorInputReplay::Replay(*Mode, Recording);
+		UE_LOG(LogManipulatorInputReplay, Display, TEXT("%s"), *Result.ToString());
+		ReturnCode = Result.Succeeded() ? 0 : 1;
+		GLevelEditorModeTools().DeactivateMode(FManipulatorToolsEditorEdMode::EM_ManipulatorToolsEditorEdModeId);
+	}
+	else
+	{
+		UE_LOG(LogManipulatorInputReplay, Error, TEXT("Couldn't activate the manipulator mode."));
+	}
+
+	GEditor->GetEditorWorldContext().SetCurrentWorld(nullptr);
+	World->RemoveFromRoot();
+	return ReturnCode;
+}
@@ -0,0 +1,190 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#include "ManipulatorLatencyStats.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogManipulatorLatency, Log, All);
+
+namespace
+{
+	/** Samples kept per stat, older ones are overwritten. */
+	const int32 MaxLatencySamples = 1024;
+
+	TAutoConsoleVariable<int32> CVarManipulatorLatencyStats(
+		TEXT("ManipulatorTools.LatencyStats"),
+		0,
+		TEXT("1 records how long manipulator clicks, drags and renders take, see ManipulatorTools.LatencyStats.Dump."));
+
+	struct FLatencySamples
+	{
+		TArray<float> Milliseconds;
+		int32 NextSample = 0;
+		/** Start of a stat waiting on the next render, 0 when nothing is waiting. */
+		uint64 PendingStartCycles = 0;
+
+		void Add(float Value)
+		{
+			if (Milliseconds.Num() < MaxLatencySamples)
+			{
+				Milliseconds.Add(Value);
+			}
+			else
+			{
+				Milliseconds[NextSample] = Value;
+			}
+			NextSample = (NextSample + 1) % MaxLatencySamples;
+		}
+	};
+
+	struct FLatencySummary
+	{
+		int32 Num = 0;
+		float Min = 0.0f;
+		float P50 = 0.0f;
+		float P95 = 0.0f;
+		float P99 = 0.0f;
+		float Max = 0.0f;
+	};
+
+	FLatencySamples LatencySamples[(int32)EManipulatorLatencyStat::Count];
+
+	const TCHAR* GetLatencyStatName(EManipulatorLatencyStat Stat)
+	{
+		switch (Stat)
+		{
+		case EManipulatorLatencyStat::ClickToVisible:
+			return TEXT("ClickToVisible");
+		case EManipulatorLatencyStat::DragToVisible:
+			return TEXT("DragToVisible");
+		case EManipulatorLatencyStat::PropertyWrite:
+			return TEXT("PropertyWrite");
+		case EManipulatorLatencyStat::PostEditChange:
+			return TEXT("PostEditChange");
+		case EManipulatorLatencyStat::SequencerKey:
+			return TEXT("SequencerKey");
+		case EManipulatorLatencyStat::Render:
+			return TEXT("Render");
+		default:
+			return TEXT("Unknown");
+		}
+	}
+
+	FLatencySummary Summarize(const FLatencySamples& Samples)
+	{
+		FLatencySummary Summary;
+		Summary.Num = Samples.Milliseconds.Num();
+		if (Summary.Num == 0)
+		{
+			return Summary;
+		}
+
+		// Nearest rank percentiles, sorting a copy is fine since this only runs when asked for.
+		TArray<float> Sorted = Samples.Milliseconds;
+		Sorted.Sort();
+		const auto Percentile = [&Sorted](float Fraction)
+		{
+			return Sorted[FMath::Clamp(FMath::CeilToInt(Fraction * Sorted.Num()) - 1, 0, Sorted.Num() - 1)];
+		};
+		Summary.Min = Sorted[0];
+		Summary.P50 = Percentile(0.50f);
+		Summary.P95 = Percentile(0.95f);
+		Summary.P99 = Percentile(0.99f);
+		Summary.Max = Sorted.Last();
+		return Summary;
+	}
+
+	FAutoConsoleCommand DumpLatencyStatsCommand(
+		TEXT("ManipulatorTools.LatencyStats.Dump"),
+		TEXT("Logs p50/p95/p99 of the manipulator latency stats."),
+		FConsoleCommandDelegate::CreateStatic(&FManipulatorLatencyStats::Dump));
+
+	FAutoConsoleCommand ResetLatencyStatsCommand(
+		TEXT("ManipulatorTools.LatencyStats.Reset"),
+		TEXT("Clears the manipulator latency stats."),
+		FConsoleCommandDelegate::CreateStatic(&FManipulatorLatencyStats::Reset));
+
+	FAutoConsoleCommand ExportLatencyStatsCommand(
+		TEXT("ManipulatorTools.LatencyStats.Export"),
+		TEXT("Writes the manipulator latency stats to a csv. Takes an optional file name, defaults to one in the profiling directory."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const FString Filename = Args.Num() > 0 ? Args[0] : FPaths::ProfilingDir() / FString::Printf(TEXT("ManipulatorLatency-%s.csv"), *FDateTime::Now().ToString());
+			if (FManipulatorLatencyStats::ExportCsv(Filename))
+			{
+				UE_LOG(LogManipulatorLatency, Display, TEXT("Wrote manipulator latency stats to %s"), *Filename);
+			}
+			else
+			{
+				UE_LOG(LogManipulatorLatency, Warning, TEXT("Couldn't write manipulator latency stats to %s"), *Filename);
+			}
+		}));
+}
+
+bool FManipulatorLatencyStats::IsEnabled()
+{
+	return CVarManipulatorLatencyStats.GetValueOnGameThread() != 0;
+}
+
+void FManipulatorLatencyStats::AddSample(EManipulatorLatencyStat Stat, uint64 StartCycles)
+{
+	const float Milliseconds = (float)FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	LatencySamples[(int32)Stat].Add(Milliseconds);
+}
+
+void FManipulatorLatencyStats::BeginUntilRendered(EManipulatorLatencyStat Stat, uint64 StartCycles)
+{
+	FLatencySamples& Samples = LatencySamples[(int32)Stat];
+	if (Samples.PendingStartCycles == 0)
+	{
+		Samples.PendingStartCycles = StartCycles;
+	}
+}
+
+void FManipulatorLatencyStats::EndRendered()
+{
+	for (FLatencySamples& Samples : LatencySamples)
+	{
+		if (Samples.PendingStartCycles != 0)
+		{
+			Samples.Add((float)FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - Samples.PendingStartCycles));
+			Samples.PendingStartCycles = 0;
+		}
+	}
+}
+
+void FManipulatorLatencyStats::Dump()
+{
+	UE_LOG(LogManipulatorLatency, Display, TEXT("%-16s %8s %9s %9s %9s %9s %9s"), TEXT("Stat"), TEXT("Samples"), TEXT("Min ms"), TEXT("p50 ms"), TEXT("p95 ms"), TEXT("p99 ms"), TEXT("Max ms"));
+	for (int32 StatIndex = 0; StatIndex < (int32)EManipulatorLatencyStat::Count; StatIndex++)
+	{
+		const FLatencySummary Summary = Summarize(LatencySamples[StatIndex]);
+		UE_LOG(LogManipulatorLatency, Display, TEXT("%-16s %8d %9.3f %9.3f %9.3f %9.3f %9.3f"), GetLatencyStatName((EManipulatorLatencyStat)StatIndex), Summary.Num, Summary.Min, Summary.P50, Summary.P95, Summary.P99, Summary.Max);
+	}
+	if (IsEnabled() == false)
+	{
+		UE_LOG(LogManipulatorLatency, Display, TEXT("Latency stats are off, set ManipulatorTools.LatencyStats 1 to record them."));
+	}
+}
+
+bool FManipulatorLatencyStats::ExportCsv(const FString& Filename)
+{
+	FString Csv = TEXT("Stat,Samples,MinMs,P50Ms,P95Ms,P99Ms,MaxMs\n");
+	for (int32 StatIndex = 0; StatIndex < (int32)EManipulatorLatencyStat::Count; StatIndex++)
+	{
+		const FLatencySummary Summary = Summarize(LatencySamples[StatIndex]);
+		Csv += FString::Printf(TEXT("%s,%d,%.4f,%.4f,%.4f,%.4f,%.4f\n"), GetLatencyStatName((EManipulatorLatencyStat)StatIndex), Summary.Num, Summary.Min, Summary.P50, Summary.P95, Summary.P99, Summary.Max);
+	}
+	return FFileHelper::SaveStringToFile(Csv, *Filename);
+}
+
+void FManipulatorLatencyStats::Reset()
+{
+	for (FLatencySamples& Samples : LatencySamples)
+	{
+		Samples = FLatencySamples();
+	}
+}
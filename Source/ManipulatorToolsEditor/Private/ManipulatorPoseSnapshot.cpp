@@ -0,0 +1,229 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#include "ManipulatorPoseSnapshot.h"
+#include "ManipulatorToolsEditorEdMode.h"
+#include "ManipulatorPropertyHandlers.h"
+#include "ManipulatorDescriptors.h"
+#include "GameFramework/Actor.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "ScopedTransaction.h"
+
+#define LOCTEXT_NAMESPACE "FManipulatorPoseSnapshot"
+
+namespace
+{
+	// Layout: Magic, Version, NumValues, then NumValues entries of Key, Type and the value itself.
+	const uint32 SnapshotMagic = 0x5350544D;
+	const uint32 SnapshotVersion = 1;
+	const int64 SnapshotNumValuesOffset = sizeof(uint32) * 2;
+	const int64 SnapshotHeaderSize = SnapshotNumValuesOffset + sizeof(int32);
+
+	void PostEditPoseProperty(UObject* Object, FEditPropertyChain& PropertyChain, EPropertyChangeType::Type ChangeType)
+	{
+		FPropertyChangedEvent PropertyChangeEvent(PropertyChain.GetActiveNode()->GetValue(), ChangeType);
+		PropertyChangeEvent.SetActiveMemberProperty(PropertyChain.GetActiveMemberNode()->GetValue());
+		FPropertyChangedChainEvent PropertyChangeChainEvent(PropertyChain, PropertyChangeEvent);
+		Object->PostEditChangeChainProperty(PropertyChangeChainEvent);
+	}
+}
+
+FManipulatorPoseSnapshot FManipulatorPoseSnapshot::Capture(const TArray<AActor*>& Actors)
+{
+	FManipulatorPoseSnapshot Snapshot;
+	FMemoryWriter Writer(Snapshot.Data);
+
+	uint32 Magic = SnapshotMagic;
+	uint32 Version = SnapshotVersion;
+	int32 NumValues = 0;
+	Writer << Magic << Version << NumValues;
+
+	TSet<FString> CapturedKeys;
+	for (AActor* Actor : Actors)
+	{
+		if (IsValid(Actor) == false)
+		{
+			continue;
+		}
+
+		ForEachManipulatorValue(Actor, [&](const FManipulatorHandle& Manipulator, int32 PropertyIndex)
+		{
+			const UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
+			FString Key = MakeKey(Manipulator, PropertyIndex);
+			bool bAlreadyCaptured = false;
+			CapturedKeys.Add(Key, &bAlreadyCaptured);
+			if (bAlreadyCaptured)
+			{
+				return;
+			}
+
+			const FManipulatorPropertyHandler& PropertyHandler = GetManipulatorPropertyHandler(ManipulatorComponent->Settings.Property.Type);
+			uint8 Type = (uint8)ManipulatorComponent->Settings.Property.Type;
+			UProperty* Property = NULL;
+			if (void* ValuePtr = PropertyHandler.Resolve(Actor, ManipulatorComponent->Settings.Property.NameToEdit, PropertyIndex, Property, NULL))
+			{
+				Writer << Key << Type;
+				PropertyHandler.Serialize(Writer, ValuePtr);
+				NumValues++;
+			}
+		});
+	}
+
+	// Now that the count is known patch it into the header.
+	Writer.Seek(SnapshotNumValuesOffset);
+	Writer << NumValues;
+	Snapshot.NumValues = NumValues;
+	return Snapshot;
+}
+
+FManipulatorPoseSnapshot FManipulatorPoseSnapshot::FromData(TArray<uint8> InData)
+{
+	FManipulatorPoseSnapshot Snapshot;
+	if (InData.Num() < SnapshotHeaderSize)
+	{
+		return Snapshot;
+	}
+
+	FMemoryReader Reader(InData);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 NumValues = 0;
+	Reader << Magic << Version << NumValues;
+	if (Magic != SnapshotMagic || Version != SnapshotVersion || NumValues < 0)
+	{
+		return Snapshot;
+	}
+
+	Snapshot.Data = MoveTemp(InData);
+	Snapshot.NumValues = NumValues;
+	return Snapshot;
+}
+
+int32 FManipulatorPoseSnapshot::Apply(const TArray<AActor*>& Actors) const
+{
+	if (IsEmpty())
+	{
+		return 0;
+	}
+
+	TMap<FString, int32> Offsets;
+	BuildOffsetMap(Offsets);
+
+	const FScopedTransaction Transaction(LOCTEXT("ApplyManipulatorPose", "Apply Manipulator Pose"));
+	FMemoryReader Reader(Data);
+	int32 NumWritten = 0;
+
+	for (AActor* Actor : Actors)
+	{
+		if (IsValid(Actor) == false)
+		{
+			continue;
+		}
+
+		TArray<TUniquePtr<FEditPropertyChain>> PropertyChains;
+		ForEachManipulatorValue(Actor, [&](const FManipulatorHandle& Manipulator, int32 PropertyIndex)
+		{
+			const UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
+			const int32* Offset = Offsets.Find(MakeKey(Manipulator, PropertyIndex));
+			if (Offset == nullptr)
+			{
+				return;
+			}
+
+			Reader.Seek(*Offset);
+			uint8 Type = 0;
+			Reader << Type;
+			// The manipulator may have been switched to another type since the pose was captured.
+			if (Type != (uint8)ManipulatorComponent->Settings.Property.Type)
+			{
+				return;
+			}
+
+			// Each value gets a notification scoped to its own property so listeners and the details panel know what changed.
+			const FManipulatorPropertyHandler& PropertyHandler = GetManipulatorPropertyHandler(ManipulatorComponent->Settings.Property.Type);
+			TUniquePtr<FEditPropertyChain> PropertyChain = MakeUnique<FEditPropertyChain>();
+			UProperty* Property = NULL;
+			void* ValuePtr = PropertyHandler.Resolve(Actor, ManipulatorComponent->Settings.Property.NameToEdit, PropertyIndex, Property, PropertyChain.Get());
+			if (ValuePtr != NULL && Property != NULL)
+			{
+				PropertyChain->SetActiveMemberPropertyNode(PropertyChain->GetHead()->GetValue());
+				PropertyChain->SetActivePropertyNode(PropertyChain->GetTail()->GetValue());
+				Actor->PreEditChange(*PropertyChain);
+				PropertyHandler.Serialize(Reader, ValuePtr);
+				PropertyChains.Add(MoveTemp(PropertyChain));
+				NumWritten++;
+			}
+		});
+
+		// All but the last are interactive so only the final notification finishes the edit, actors that don't run their construction script on drag only rerun it once for the whole pose.
+		for (int32 ChainIndex = 0; ChainIndex < PropertyChains.Num(); ChainIndex++)
+		{
+			const bool bLastEdit = ChainIndex == PropertyChains.Num() - 1;
+			PostEditPoseProperty(Actor, *PropertyChains[ChainIndex], bLastEdit ? EPropertyChangeType::ValueSet : EPropertyChangeType::Interactive);
+		}
+	}
+
+	return NumWritten;
+}
+
+FString FManipulatorPoseSnapshot::MakeKey(const FManipulatorHandle& Manipulator, int32 PropertyIndex)
+{
+	// Names are used instead of FNames or pointers so keys stay the same between editor sessions and actor instances.
+	return FString::Printf(TEXT("%s.%s[%d]"), *Manipulator.GetName().ToString(), *Manipulator.GetComponent()->Settings.Property.NameToEdit, PropertyIndex);
+}
+
+void FManipulatorPoseSnapshot::ForEachManipulatorValue(AActor* Actor, TFunctionRef<void(const FManipulatorHandle&, int32)> Visitor)
+{
+	TArray<FManipulatorHandle> Manipulators;
+	FManipulatorDescriptors::GetActorManipulators(Actor, Manipulators);
+	for (const FManipulatorHandle& Manipulator : Manipulators)
+	{
+		const UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
+		if (IsValid(ManipulatorComponent) == false || ManipulatorComponent->Settings.Property.NameToEdit.IsEmpty())
+		{
+			continue;
+		}
+
+		if (ManipulatorComponent->DrivesAllArrayElements())
+		{
+			const int32 NumElements = GetPropertyArrayNumByName(Actor, ManipulatorComponent->Settings.Property.NameToEdit);
+			for (int32 ElementIndex = 0; ElementIndex < NumElements; ElementIndex++)
+			{
+				Visitor(Manipulator, ElementIndex);
+			}
+		}
+		else
+		{
+			Visitor(Manipulator, ManipulatorComponent->Settings.Property.Index);
+		}
+	}
+}
+
+void FManipulatorPoseSnapshot::BuildOffsetMap(TMap<FString, int32>& OutOffsets) const
+{
+	OutOffsets.Reset();
+	OutOffsets.Reserve(NumValues);
+
+	FMemoryReader Reader(Data);
+	Reader.Seek(SnapshotHeaderSize);
+	for (int32 i = 0; i < NumValues && !Reader.AtEnd(); i++)
+	{
+		FString Key;
+		Reader << Key;
+		const int32 Offset = (int32)Reader.Tell();
+
+		uint8 Type = 0;
+		Reader << Type;
+		const FManipulatorPropertyHandler* PropertyHandler = FindManipulatorPropertyHandler(Type);
+		if (PropertyHandler == nullptr)
+		{
+			// Without knowing the size of the value nothing after it can be found.
+			break;
+		}
+		PropertyHandler->Skip(Reader);
+
+		OutOffsets.Add(Key, Offset);
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,328 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#include "ManipulatorPropertyHandlers.h"
+#include "ManipulatorToolsEditorEdMode.h"
+#include "MovieSceneTransformTrack.h"
+#include "MovieSceneVectorTrack.h"
+#include "MovieSceneByteTrack.h"
+#include "MovieSceneBoolTrack.h"
+#include "Channels/MovieSceneChannelProxy.h"
+#include "Channels/MovieSceneByteChannel.h"
+#include "Channels/MovieSceneBoolChannel.h"
+
+namespace
+{
+	float GetEnumDirectionComponent(const FVector& Vector, EManipulatorPropertyEnumDirection Direction)
+	{
+		switch (Direction)
+		{
+		case EManipulatorPropertyEnumDirection::MT_Y:
+			return Vector.Y;
+		case EManipulatorPropertyEnumDirection::MT_Z:
+			return Vector.Z;
+		default:
+			return Vector.X;
+		}
+	}
+
+	/** Turns gathered transforms into float channel keys, 3 location channels plus rotation and scale when bRotationAndScale. */
+	void BuildTransformBakeKeys(FManipulatorBakeValues& Values, bool bRotationAndScale)
+	{
+		const int32 NumFrames = Values.Transforms.Num();
+		Values.FloatKeys.SetNum(bRotationAndScale ? 9 : 3);
+		for (TArray<FMovieSceneFloatValue>& Keys : Values.FloatKeys)
+		{
+			Keys.Reserve(NumFrames);
+		}
+
+		FRotator PreviousRotation = FRotator::ZeroRotator;
+		for (int32 Frame = 0; Frame < NumFrames; Frame++)
+		{
+			const FTransform& Transform = Values.Transforms[Frame];
+			const FVector Location = Transform.GetLocation();
+			Values.FloatKeys[0].Add(FMovieSceneFloatValue(Location.X));
+			Values.FloatKeys[1].Add(FMovieSceneFloatValue(Location.Y));
+			Values.FloatKeys[2].Add(FMovieSceneFloatValue(Location.Z));
+
+			if (bRotationAndScale)
+			{
+				// Keep each rotation within 180 degrees of the last so the curves don't flip between frames.
+				FRotator Rotation = Transform.Rotator();
+				if (Frame > 0)
+				{
+					PreviousRotation.SetClosestToMe(Rotation);
+				}
+				PreviousRotation = Rotation;
+
+				const FVector Scale = Transform.GetScale3D();
+				Values.FloatKeys[3].Add(FMovieSceneFloatValue(Rotation.Roll));
+				Values.FloatKeys[4].Add(FMovieSceneFloatValue(Rotation.Pitch));
+				Values.FloatKeys[5].Add(FMovieSceneFloatValue(Rotation.Yaw));
+				Values.FloatKeys[6].Add(FMovieSceneFloatValue(Scale.X));
+				Values.FloatKeys[7].Add(FMovieSceneFloatValue(Scale.Y));
+				Values.FloatKeys[8].Add(FMovieSceneFloatValue(Scale.Z));
+			}
+		}
+	}
+
+	/** Keys outside the baked times are kept, everything between the first and last baked time is replaced. */
+	template<typename ValueType>
+	void MergeKeys(TArrayView<const FFrameNumber> OldTimes, TArrayView<const ValueType> OldValues, const TArray<FFrameNumber>& BakedTimes, const TArray<ValueType>& BakedValues, TArray<FFrameNumber>& OutTimes, TArray<ValueType>& OutValues)
+	{
+		OutTimes.Reset(OldTimes.Num() + BakedTimes.Num());
+		OutValues.Reset(OldTimes.Num() + BakedTimes.Num());
+
+		int32 OldIndex = 0;
+		for (; OldIndex < OldTimes.Num() && OldTimes[OldIndex] < BakedTimes[0]; OldIndex++)
+		{
+			OutTimes.Add(OldTimes[OldIndex]);
+			OutValues.Add(OldValues[OldIndex]);
+		}
+
+		OutTimes.Append(BakedTimes);
+		OutValues.Append(BakedValues);
+
+		for (; OldIndex < OldTimes.Num(); OldIndex++)
+		{
+			if (OldTimes[OldIndex] > BakedTimes.Last())
+			{
+				OutTimes.Add(OldTimes[OldIndex]);
+				OutValues.Add(OldValues[OldIndex]);
+			}
+		}
+	}
+
+	void WriteChannel(FMovieSceneFloatChannel* Channel, const TArray<FFrameNumber>& Times, const TArray<FMovieSceneFloatValue>& Values)
+	{
+		TArray<FFrameNumber> MergedTimes;
+		TArray<FMovieSceneFloatValue> MergedValues;
+		TMovieSceneChannelData<FMovieSceneFloatValue> ChannelData = Channel->GetData();
+		MergeKeys<FMovieSceneFloatValue>(ChannelData.GetTimes(), ChannelData.GetValues(), Times, Values, MergedTimes, MergedValues);
+
+		Channel->Set(MoveTemp(MergedTimes), MoveTemp(MergedValues));
+		Channel->AutoSetTangents();
+	}
+
+	template<typename ChannelType, typename ValueType>
+	void WriteChannel(ChannelType* Channel, const TArray<FFrameNumber>& Times, const TArray<ValueType>& Values)
+	{
+		TArray<FFrameNumber> MergedTimes;
+		TArray<ValueType> MergedValues;
+		TMovieSceneChannelData<ValueType> ChannelData = Channel->GetData();
+		MergeKeys<ValueType>(ChannelData.GetTimes(), ChannelData.GetValues(), Times, Values, MergedTimes, MergedValues);
+
+		// Keys go in already sorted so every add lands on the end.
+		ChannelData.Reset();
+		for (int32 KeyIndex = 0; KeyIndex < MergedTimes.Num(); KeyIndex++)
+		{
+			ChannelData.AddKey(MergedTimes[KeyIndex], MergedValues[KeyIndex]);
+		}
+	}
+
+	void WriteFloatBakeKeys(FMovieSceneChannelProxy& ChannelProxy, const TArray<FFrameNumber>& Times, const FManipulatorBakeValues& Values)
+	{
+		TArrayView<FMovieSceneFloatChannel*> Channels = ChannelProxy.GetChannels<FMovieSceneFloatChannel>();
+		const int32 NumChannels = FMath::Min(Channels.Num(), Values.FloatKeys.Num());
+		for (int32 ChannelIndex = 0; ChannelIndex < NumChannels; ChannelIndex++)
+		{
+			WriteChannel(Channels[ChannelIndex], Times, Values.FloatKeys[ChannelIndex]);
+		}
+	}
+
+	template<EManipulatorPropertyType PropertyType>
+	FManipulatorPropertyHandler MakeManipulatorPropertyHandler()
+	{
+		typedef TManipulatorPropertyTraits<PropertyType> Traits;
+		typedef typename Traits::ValueType ValueType;
+
+		FManipulatorPropertyHandler Handler;
+		Handler.Type = PropertyType;
+		Handler.bUsesWidget = Traits::bUsesWidget;
+		Handler.bHasFloatChannels = Traits::bHasFloatChannels;
+
+		Handler.Resolve = [](UObject* Object, const FString& PropertyName, int32 PropertyIndex, UProperty*& OutProperty, FEditPropertyChain* OutPropertyChain) -> void*
+		{
+			if (IsValid(Object) == false)
+			{
+				return nullptr;
+			}
+			return GetPropertyValuePtrByName<ValueType>(Object->GetClass(), Object, PropertyName, PropertyIndex, OutProperty, OutPropertyChain);
+		};
+
+		Handler.Read = [](UObject* Object, const FManipulatorSettingsMainProperty& Settings, int32 PropertyIndex, FTransform& OutPropertyTransform, FVector& OutWidgetOffset) -> bool
+		{
+			UProperty* Property = NULL;
+			const ValueType* ValuePtr = IsValid(Object) ? GetPropertyValuePtrByName<ValueType>(Object->GetClass(), Object, Settings.NameToEdit, PropertyIndex, Property) : nullptr;
+			if (ValuePtr == nullptr)
+			{
+				return false;
+			}
+			OutPropertyTransform = Traits::ToTransform(*ValuePtr, Settings);
+			OutWidgetOffset = Traits::GetWidgetOffset(*ValuePtr, Settings);
+			return true;
+		};
+
+		Handler.ApplyTransform = [](void* ValuePtr, const FTransform& NewTransform, const FManipulatorSettingsMainProperty& Settings)
+		{
+			Traits::ApplyTransform(*(ValueType*)ValuePtr, NewTransform, Settings);
+		};
+
+		Handler.Serialize = [](FArchive& Ar, void* ValuePtr)
+		{
+			Traits::Serialize(Ar, *(ValueType*)ValuePtr);
+		};
+
+		Handler.Skip = [](FArchive& Ar)
+		{
+			ValueType Value = ValueType();
+			Traits::Serialize(Ar, Value);
+		};
+
+		Handler.GetTrackClass = &Traits::GetTrackClass;
+
+		Handler.ReserveBakeValues = [](FManipulatorBakeValues& Values, int32 NumFrames)
+		{
+			if (Traits::bHasFloatChannels)
+			{
+				Values.Transforms.Reserve(NumFrames);
+			}
+			else
+			{
+				Values.Bytes.Reserve(NumFrames);
+			}
+		};
+
+		Handler.GatherBakeValue = [](UObject* Object, const FString& PropertyName, int32 PropertyIndex, FManipulatorBakeValues& Values)
+		{
+			Traits::GatherBakeValue(GetPropertyValueByName<ValueType>(Object, PropertyName, PropertyIndex), Values);
+		};
+
+		Handler.BuildBakeKeys = &Traits::BuildBakeKeys;
+		Handler.WriteBakeKeys = &Traits::WriteBakeKeys;
+		return Handler;
+	}
+}
+
+UClass* TManipulatorPropertyTraits<EManipulatorPropertyType::MT_TRANSFORM>::GetTrackClass()
+{
+	return UMovieSceneTransformTrack::StaticClass();
+}
+
+void TManipulatorPropertyTraits<EManipulatorPropertyType::MT_TRANSFORM>::BuildBakeKeys(FManipulatorBakeValues& Values)
+{
+	BuildTransformBakeKeys(Values, true);
+}
+
+void TManipulatorPropertyTraits<EManipulatorPropertyType::MT_TRANSFORM>::WriteBakeKeys(FMovieSceneChannelProxy& ChannelProxy, const TArray<FFrameNumber>& Times, const FManipulatorBakeValues& Values)
+{
+	WriteFloatBakeKeys(ChannelProxy, Times, Values);
+}
+
+UClass* TManipulatorPropertyTraits<EManipulatorPropertyType::MT_VECTOR>::GetTrackClass()
+{
+	return UMovieSceneVectorTrack::StaticClass();
+}
+
+void TManipulatorPropertyTraits<EManipulatorPropertyType::MT_VECTOR>::BuildBakeKeys(FManipulatorBakeValues& Values)
+{
+	BuildTransformBakeKeys(Values, false);
+}
+
+void TManipulatorPropertyTraits<EManipulatorPropertyType::MT_VECTOR>::WriteBakeKeys(FMovieSceneChannelProxy& ChannelProxy, const TArray<FFrameNumber>& Times, const FManipulatorBakeValues& Values)
+{
+	WriteFloatBakeKeys(ChannelProxy, Times, Values);
+}
+
+FVector TManipulatorPropertyTraits<EManipulatorPropertyType::MT_ENUM>::GetWidgetOffset(const uint8& Value, const FManipulatorSettingsMainProperty& Settings)
+{
+	//Use the direction vector * Step to calulate the offset position of the current enum.
+	FVector EnumPropertyOffset = FVector::ZeroVector;
+	const float Offset = Settings.EnumSettings.StepSize * Value;
+	switch (Settings.EnumSettings.Direction)
+	{
+	case EManipulatorPropertyEnumDirection::MT_X:
+		EnumPropertyOffset.X = Offset;
+		break;
+	case EManipulatorPropertyEnumDirection::MT_Y:
+		EnumPropertyOffset.Y = Offset;
+		break;
+	case EManipulatorPropertyEnumDirection::MT_Z:
+		EnumPropertyOffset.Z = Offset;
+		break;
+	}
+	return EnumPropertyOffset;
+}
+
+void TManipulatorPropertyTraits<EManipulatorPropertyType::MT_ENUM>::ApplyTransform(uint8& Value, const FTransform& NewTransform, const FManipulatorSettingsMainProperty& Settings)
+{
+	const FManipulatorSettingsMainPropertyTypeEnum& EnumSettings = Settings.EnumSettings;
+	const float AxisCheck = GetEnumDirectionComponent(NewTransform.GetLocation(), EnumSettings.Direction);
+
+	//add and clamp output.
+	float EnumAsFloat = Value + (FMath::GridSnap(AxisCheck, EnumSettings.StepSize) / EnumSettings.StepSize);
+	if (EnumAsFloat > EnumSettings.EnumSize - 1)
+	{
+		EnumAsFloat = EnumSettings.EnumSize - 1;
+	}
+	else if (EnumAsFloat < 0)
+	{
+		EnumAsFloat = 0;
+	}
+	Value = uint8(EnumAsFloat);
+}
+
+UClass* TManipulatorPropertyTraits<EManipulatorPropertyType::MT_ENUM>::GetTrackClass()
+{
+	return UMovieSceneByteTrack::StaticClass();
+}
+
+void TManipulatorPropertyTraits<EManipulatorPropertyType::MT_ENUM>::WriteBakeKeys(FMovieSceneChannelProxy& ChannelProxy, const TArray<FFrameNumber>& Times, const FManipulatorBakeValues& Values)
+{
+	TArrayView<FMovieSceneByteChannel*> Channels = ChannelProxy.GetChannels<FMovieSceneByteChannel>();
+	if (Channels.Num() > 0)
+	{
+		WriteChannel<FMovieSceneByteChannel, uint8>(Channels[0], Times, Values.Bytes);
+	}
+}
+
+UClass* TManipulatorPropertyTraits<EManipulatorPropertyType::MT_BOOL>::GetTrackClass()
+{
+	return UMovieSceneBoolTrack::StaticClass();
+}
+
+void TManipulatorPropertyTraits<EManipulatorPropertyType::MT_BOOL>::WriteBakeKeys(FMovieSceneChannelProxy& ChannelProxy, const TArray<FFrameNumber>& Times, const FManipulatorBakeValues& Values)
+{
+	TArray<bool> BoolValues;
+	BoolValues.Reserve(Values.Bytes.Num());
+	for (uint8 Value : Values.Bytes)
+	{
+		BoolValues.Add(Value != 0);
+	}
+
+	TArrayView<FMovieSceneBoolChannel*> Channels = ChannelProxy.GetChannels<FMovieSceneBoolChannel>();
+	if (Channels.Num() > 0)
+	{
+		WriteChannel<FMovieSceneBoolChannel, bool>(Channels[0], Times, BoolValues);
+	}
+}
+
+const FManipulatorPropertyHandler* FindManipulatorPropertyHandler(uint8 Type)
+{
+	// Same order as EManipulatorPropertyType so the type is the index.
+	static const FManipulatorPropertyHandler Handlers[] =
+	{
+		MakeManipulatorPropertyHandler<EManipulatorPropertyType::MT_TRANSFORM>(),
+		MakeManipulatorPropertyHandler<EManipulatorPropertyType::MT_VECTOR>(),
+		MakeManipulatorPropertyHandler<EManipulatorPropertyType::MT_ENUM>(),
+		MakeManipulatorPropertyHandler<EManipulatorPropertyType::MT_BOOL>(),
+	};
+
+	return Type < ARRAY_COUNT(Handlers) ? &Handlers[Type] : nullptr;
+}
+
+const FManipulatorPropertyHandler& GetManipulatorPropertyHandler(EManipulatorPropertyType Type)
+{
+	const FManipulatorPropertyHandler* Handler = FindManipulatorPropertyHandler((uint8)Type);
+	check(Handler != nullptr);
+	return *Handler;
+}
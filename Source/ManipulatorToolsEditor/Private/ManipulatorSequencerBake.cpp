@@ -0,0 +1,202 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#include "ManipulatorSequencerBake.h"
+#include "ManipulatorToolsEditorEdMode.h"
+#include "ManipulatorPropertyHandlers.h"
+#include "ManipulatorDescriptors.h"
+#include "GameFramework/Actor.h"
+#include "ISequencer.h"
+#include "MovieScene.h"
+#include "MovieSceneSequence.h"
+#include "MovieSceneSection.h"
+#include "MovieSceneVectorTrack.h"
+#include "MovieScenePropertyTrack.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopedSlowTask.h"
+#include "ScopedTransaction.h"
+
+#define LOCTEXT_NAMESPACE "FManipulatorSequencerBake"
+
+namespace
+{
+	/** One baked property and everything gathered for it. */
+	struct FManipulatorBakeTarget
+	{
+		AActor* Actor = nullptr;
+		FString PropertyName;
+		int32 PropertyIndex = 0;
+		const FManipulatorPropertyHandler* Handler = nullptr;
+		FManipulatorBakeValues Values;
+	};
+
+	UMovieSceneSection* FindOrAddSection(UMovieSceneTrack* Track, const TRange<FFrameNumber>& Range)
+	{
+		const TArray<UMovieSceneSection*>& Sections = Track->GetAllSections();
+		UMovieSceneSection* Section = Sections.Num() > 0 ? Sections[0] : nullptr;
+		if (Section == nullptr)
+		{
+			Section = Track->CreateNewSection();
+			Section->SetRange(Range);
+			Track->AddSection(*Section);
+			return Section;
+		}
+
+		Section->Modify();
+		if (!Section->GetRange().Contains(Range))
+		{
+			Section->SetRange(TRange<FFrameNumber>::Hull(Section->GetRange(), Range));
+		}
+		return Section;
+	}
+
+	UMovieSceneTrack* FindOrAddTrack(UMovieScene* MovieScene, const FGuid& ObjectBinding, const FManipulatorBakeTarget& Target)
+	{
+		FString LeafName;
+		if (!Target.PropertyName.Split(TEXT("."), nullptr, &LeafName, ESearchCase::CaseSensitive, ESearchDir::FromEnd))
+		{
+			LeafName = Target.PropertyName;
+		}
+
+		TSubclassOf<UMovieSceneTrack> TrackClass = Target.Handler->GetTrackClass();
+		UMovieSceneTrack* Track = MovieScene->FindTrack(TrackClass, ObjectBinding, FName(*LeafName));
+		if (Track == nullptr)
+		{
+			Track = MovieScene->AddTrack(TrackClass, ObjectBinding);
+			if (UMovieSceneVectorTrack* VectorTrack = Cast<UMovieSceneVectorTrack>(Track))
+			{
+				VectorTrack->SetNumChannelsUsed(3);
+			}
+			CastChecked<UMovieScenePropertyTrack>(Track)->SetPropertyNameAndPath(FName(*LeafName), Target.PropertyName);
+		}
+		Track->Modify();
+		return Track;
+	}
+}
+
+int32 FManipulatorSequencerBake::Bake(TSharedRef<ISequencer> Sequencer, const TArray<AActor*>& Actors, TRange<FFrameNumber> Range)
+{
+	UMovieSceneSequence* Sequence = Sequencer->GetFocusedMovieSceneSequence();
+	UMovieScene* MovieScene = Sequence ? Sequence->GetMovieScene() : nullptr;
+	if (MovieScene == nullptr || !Range.HasLowerBound() || !Range.HasUpperBound())
+	{
+		return 0;
+	}
+
+	// Every manipulated property once, array wide manipulators are skipped since tracks can't key a single element.
+	TArray<FManipulatorBakeTarget> Targets;
+	TSet<FString> BakedProperties;
+	TArray<FManipulatorHandle> Manipulators;
+	for (AActor* Actor : Actors)
+	{
+		if (IsValid(Actor) == false)
+		{
+			continue;
+		}
+
+		FManipulatorDescriptors::GetActorManipulators(Actor, Manipulators);
+		for (const FManipulatorHandle& Manipulator : Manipulators)
+		{
+			const UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
+			if (IsValid(ManipulatorComponent) == false || ManipulatorComponent->Settings.Property.NameToEdit.IsEmpty() || ManipulatorComponent->DrivesAllArrayElements())
+			{
+				continue;
+			}
+
+			bool bAlreadyBaked = false;
+			BakedProperties.Add(Actor->GetPathName() + TEXT(".") + ManipulatorComponent->Settings.Property.NameToEdit, &bAlreadyBaked);
+			if (bAlreadyBaked)
+			{
+				continue;
+			}
+
+			FManipulatorBakeTarget& Target = Targets[Targets.AddDefaulted()];
+			Target.Actor = Actor;
+			Target.PropertyName = ManipulatorComponent->Settings.Property.NameToEdit;
+			Target.PropertyIndex = ManipulatorComponent->Settings.Property.Index;
+			Target.Handler = &GetManipulatorPropertyHandler(ManipulatorComponent->Settings.Property.Type);
+		}
+	}
+
+	// Key every display frame, stored at tick resolution.
+	const FFrameRate TickResolution = Sequencer->GetFocusedTickResolution();
+	const FFrameRate DisplayRate = Sequencer->GetFocusedDisplayRate();
+	const FFrameNumber StartFrame = FFrameRate::TransformTime(FFrameTime(Range.GetLowerBoundValue()), TickResolution, DisplayRate).CeilToFrame();
+	const FFrameNumber EndFrame = FFrameRate::TransformTime(FFrameTime(Range.GetUpperBoundValue()), TickResolution, DisplayRate).FloorToFrame();
+	const bool bIncludeEndFrame = Range.GetUpperBound().IsInclusive();
+
+	TArray<FFrameNumber> Times;
+	for (FFrameNumber DisplayFrame = StartFrame; DisplayFrame < EndFrame || (bIncludeEndFrame && DisplayFrame == EndFrame); DisplayFrame.Value++)
+	{
+		Times.Add(FFrameRate::TransformTime(FFrameTime(DisplayFrame), DisplayRate, TickResolution).RoundToFrame());
+	}
+
+	if (Targets.Num() == 0 || Times.Num() == 0)
+	{
+		return 0;
+	}
+
+	FScopedSlowTask SlowTask(Times.Num() + 2, LOCTEXT("BakingManipulators", "Baking Manipulators"));
+	SlowTask.MakeDialog(true);
+
+	for (FManipulatorBakeTarget& Target : Targets)
+	{
+		Target.Handler->ReserveBakeValues(Target.Values, Times.Num());
+	}
+
+	// Evaluating the sequence writes to the actors so this part stays on the game thread, it only reads values into the flat buffers.
+	const FFrameTime PreviousTime = Sequencer->GetGlobalTime().Time;
+	for (const FFrameNumber& Time : Times)
+	{
+		SlowTask.EnterProgressFrame(1);
+		if (SlowTask.ShouldCancel())
+		{
+			// Put the actors back to the current frame rather than leaving them on the last baked one.
+			Sequencer->SetGlobalTime(PreviousTime);
+			Sequencer->ForceEvaluate();
+			return 0;
+		}
+
+		Sequencer->SetGlobalTime(FFrameTime(Time));
+		Sequencer->ForceEvaluate();
+		for (FManipulatorBakeTarget& Target : Targets)
+		{
+			Target.Handler->GatherBakeValue(Target.Actor, Target.PropertyName, Target.PropertyIndex, Target.Values);
+		}
+	}
+	Sequencer->SetGlobalTime(PreviousTime);
+	Sequencer->ForceEvaluate();
+
+	// Turning values into keys only reads each target's own buffers so tracks are converted in parallel.
+	SlowTask.EnterProgressFrame(1);
+	ParallelFor(Targets.Num(), [&Targets](int32 TargetIndex)
+	{
+		FManipulatorBakeTarget& Target = Targets[TargetIndex];
+		Target.Handler->BuildBakeKeys(Target.Values);
+	});
+
+	// One write per channel.
+	SlowTask.EnterProgressFrame(1);
+	const FScopedTransaction Transaction(LOCTEXT("BakeManipulatorsToSequencer", "Bake Manipulators To Sequencer"));
+	MovieScene->Modify();
+	const TRange<FFrameNumber> KeyRange = TRange<FFrameNumber>(Times[0], Times.Last() + 1);
+
+	int32 NumTracksBaked = 0;
+	for (const FManipulatorBakeTarget& Target : Targets)
+	{
+		const FGuid ObjectBinding = Sequencer->GetHandleToObject(Target.Actor);
+		if (!ObjectBinding.IsValid())
+		{
+			continue;
+		}
+
+		UMovieSceneTrack* Track = FindOrAddTrack(MovieScene, ObjectBinding, Target);
+		UMovieSceneSection* Section = FindOrAddSection(Track, KeyRange);
+		Target.Handler->WriteBakeKeys(Section->GetChannelProxy(), Times, Target.Values);
+		NumTracksBaked++;
+	}
+
+	Sequencer->NotifyMovieSceneDataChanged(EMovieSceneDataChangeType::MovieSceneStructureItemsChanged);
+	return NumTracksBaked;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -3,6 +3,7 @@
 #include "ManipulatorToolsEditor.h"
 #include "ManipulatorToolsEditorEdMode.h"
 #include "ManipulatorToolsEditorEdModeStyle.h"
+#include "ManipulatorAssetIndex.h"
 #include "PropertyEditorModule.h"
 #include "EditorModeManager.h"
 #include "MovieSceneSequence.h"
@@ -16,6 +17,8 @@ void FManipulatorToolsEditorModule::StartupModule()
 	// Register for when the sequencer is opened in the editor to grab the reference.
 	ISequencerModule& SequencerModule = FModuleManager::Get().LoadModuleChecked<ISequencerModule>("Sequencer");
 	SequencerCreatedHandle = SequencerModule.RegisterOnSequencerCreated(FOnSequencerCreated::FDelegate::CreateRaw(this, &FManipulatorToolsEditorModule::HandleSequencerCreated));
+
+	FManipulatorAssetIndex::Register();
 }
 
 void FManipulatorToolsEditorModule::ShutdownModule()
@@ -29,6 +32,8 @@ void FManipulatorToolsEditorModule::ShutdownModule()
 	{
 		SequencerModule->UnregisterOnSequencerCreated(SequencerCreatedHandle);
 	}
+
+	FManipulatorAssetIndex::Unregister();
 }
 
 void FManipulatorToolsEditorModule::HandleSequencerCreated(TSharedRef<ISequencer> InSequencer)
@@ -16,6 +16,8 @@
 #include "MovieSceneByteTrack.h"
 #include "MovieSceneBoolTrack.h"
 #include "MovieScenePropertyTrack.h"
+#include "Channels/MovieSceneChannelProxy.h"
+#include "Channels/MovieSceneFloatChannel.h"
 #include "Materials/MaterialInterface.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "LevelEditorViewport.h"
@@ -23,6 +25,150 @@
 #include "UObject/UObjectIterator.h"
 #include "Materials/Material.h"
 #include "ManipulatorToolsEditor.h"
+#include "ScopedTransaction.h"
+#include "ManipulatorPoseLibrary.h"
+#include "ManipulatorSequencerBake.h"
+#include "ManipulatorDescriptors.h"
+#include "ManipulatorLatencyStats.h"
+#include "ManipulatorInputRecording.h"
+#include "ManipulatorPropertyHandlers.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#define LOCTEXT_NAMESPACE "FManipulatorToolsEditorEdMode"
+
+IMPLEMENT_HIT_PROXY(HManipulatorProxy, HHitProxy);
+
+namespace
+{
+	/** Swaps the left/right marker in a manipulator name, returns an empty string if it doesn't have one. */
+	FString GetMirroredManipulatorName(const FString& Name)
+	{
+		static const TCHAR* InfixMarkers[][2] = { { TEXT("_L_"), TEXT("_R_") }, { TEXT("Left"), TEXT("Right") }, { TEXT("left"), TEXT("right") } };
+		static const TCHAR* SuffixMarkers[][2] = { { TEXT("_L"), TEXT("_R") }, { TEXT("_l"), TEXT("_r") } };
+		static const TCHAR* PrefixMarkers[][2] = { { TEXT("L_"), TEXT("R_") } };
+
+		for (int32 Side = 0; Side < 2; Side++)
+		{
+			for (const auto& Marker : InfixMarkers)
+			{
+				if (Name.Contains(Marker[Side], ESearchCase::CaseSensitive))
+				{
+					return Name.Replace(Marker[Side], Marker[1 - Side], ESearchCase::CaseSensitive);
+				}
+			}
+			for (const auto& Marker : SuffixMarkers)
+			{
+				if (Name.EndsWith(Marker[Side], ESearchCase::CaseSensitive))
+				{
+					return Name.LeftChop(FCString::Strlen(Marker[Side])) + Marker[1 - Side];
+				}
+			}
+			for (const auto& Marker : PrefixMarkers)
+			{
+				if (Name.StartsWith(Marker[Side], ESearchCase::CaseSensitive))
+				{
+					return Marker[1 - Side] + Name.RightChop(FCString::Strlen(Marker[Side]));
+				}
+			}
+		}
+		return FString();
+	}
+
+	/** Float channels of the transform or vector track keying Property on Object, these are the only channels that build up in-between keys. */
+	void GetKeyedFloatChannels(ISequencer& Sequencer, UObject* Object, UProperty* Property, TArray<TPair<UMovieSceneSection*, FMovieSceneFloatChannel*>>& OutChannels)
+	{
+		OutChannels.Reset();
+		UMovieSceneSequence* Sequence = Sequencer.GetFocusedMovieSceneSequence();
+		const FGuid ObjectBinding = Sequence ? Sequencer.FindObjectId(*Object, Sequencer.GetFocusedTemplateID()) : FGuid();
+		if (!ObjectBinding.IsValid())
+		{
+			return;
+		}
+
+		const TSubclassOf<UMovieSceneTrack> TrackClasses[] = { UMovieSceneTransformTrack::StaticClass(), UMovieSceneVectorTrack::StaticClass() };
+		for (TSubclassOf<UMovieSceneTrack> TrackClass : TrackClasses)
+		{
+			if (UMovieSceneTrack* Track = Sequence->GetMovieScene()->FindTrack(TrackClass, ObjectBinding, Property->GetFName()))
+			{
+				for (UMovieSceneSection* Section : Track->GetAllSections())
+				{
+					for (FMovieSceneFloatChannel* Channel : Section->GetChannelProxy().GetChannels<FMovieSceneFloatChannel>())
+					{
+						OutChannels.Emplace(Section, Channel);
+					}
+				}
+			}
+		}
+	}
+
+	bool HasFloatKeyAt(ISequencer& Sequencer, UObject* Object, UProperty* Property, FFrameNumber Frame)
+	{
+		TArray<TPair<UMovieSceneSection*, FMovieSceneFloatChannel*>> Channels;
+		GetKeyedFloatChannels(Sequencer, Object, Property, Channels);
+		for (const TPair<UMovieSceneSection*, FMovieSceneFloatChannel*>& Channel : Channels)
+		{
+			if (Channel.Value->GetData().GetTimes().Contains(Frame))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * Removes keys at CreatedFrames that the keys around them already describe to within Tolerance, keys at any other time are never touched.
+	 * Greedy, a created key goes when the line from the last kept key to the key after it passes within Tolerance of it and of every key dropped since.
+	 */
+	bool ReduceCreatedKeys(UMovieSceneSection* Section, FMovieSceneFloatChannel* Channel, const TArray<FFrameNumber>& CreatedFrames, float Tolerance)
+	{
+		TMovieSceneChannelData<FMovieSceneFloatValue> ChannelData = Channel->GetData();
+		TArrayView<const FFrameNumber> Times = ChannelData.GetTimes();
+		TArrayView<const FMovieSceneFloatValue> Values = ChannelData.GetValues();
+
+		TArray<int32> KeysToRemove;
+		int32 LastKept = 0;
+		for (int32 KeyIndex = 1; KeyIndex + 1 < Times.Num(); KeyIndex++)
+		{
+			if (CreatedFrames.Contains(Times[KeyIndex]) == false)
+			{
+				LastKept = KeyIndex;
+				continue;
+			}
+
+			const int32 NextIndex = KeyIndex + 1;
+			const float Span = (float)(Times[NextIndex] - Times[LastKept]).Value;
+			bool bWithinTolerance = true;
+			for (int32 CheckIndex = LastKept + 1; CheckIndex <= KeyIndex && bWithinTolerance; CheckIndex++)
+			{
+				const float Alpha = (float)(Times[CheckIndex] - Times[LastKept]).Value / Span;
+				bWithinTolerance = FMath::Abs(FMath::Lerp(Values[LastKept].Value, Values[NextIndex].Value, Alpha) - Values[CheckIndex].Value) <= Tolerance;
+			}
+
+			if (bWithinTolerance)
+			{
+				KeysToRemove.Add(KeyIndex);
+			}
+			else
+			{
+				LastKept = KeyIndex;
+			}
+		}
+
+		if (KeysToRemove.Num() == 0)
+		{
+			return false;
+		}
+
+		Section->Modify();
+		for (int32 RemoveIndex = KeysToRemove.Num() - 1; RemoveIndex >= 0; RemoveIndex--)
+		{
+			ChannelData.RemoveKey(KeysToRemove[RemoveIndex]);
+		}
+		Channel->AutoSetTangents();
+		return true;
+	}
+}
 
 const FEditorModeID FManipulatorToolsEditorEdMode::EM_ManipulatorToolsEditorEdModeId = TEXT("EM_ManipulatorToolsEditorEdMode");
 
@@ -53,6 +199,19 @@ void FManipulatorToolsEditorEdMode::Enter()
 
 void FManipulatorToolsEditorEdMode::Exit()
 {
+	FlushPendingKeys();
+	UManipulatorComponent::BroadcastSelectionChanges();
+	DragKeyedProperties.Reset();
+	DragTransaction.Reset();
+	DrawCache.Reset();
+	PlaneMeshes.Reset();
+	ManipulatorFrameElements.Reset();
+	InvalidateManipulatorFrame();
+	MirrorPartners.Reset();
+	FManipulatorDescriptors::Reset();
+	InputRecording.Reset();
+	SelectedManipulatorTracks.Reset();
+
 	if (Toolkit.IsValid())
 	{
 		ClearManipulatorSelection();
@@ -73,11 +232,42 @@ void FManipulatorToolsEditorEdMode::Render(const FSceneView * View, FViewport *
 	{
 		return;
 	}
+
+	FManipulatorLatencyScope LatencyScope(EManipulatorLatencyStat::Render);
+
+	// Render runs once per viewport, everything that doesn't depend on the view is only worked out by the first one each frame.
+	UpdateManipulatorFrame();
+
+	for (const FManipulatorFrameElement& Element : ManipulatorFrameElements)
+	{
+		if (Element.Manipulator.IsValid())
+		{
+			DrawManipulator(View, PDI, Element.Manipulator, Element.PropertyIndex, Element.WidgetTransform, Element.DrawColor);
+		}
+	}
+	FEdMode::Render(View, Viewport, PDI);
+
+	if (FManipulatorLatencyStats::IsEnabled())
+	{
+		FManipulatorLatencyStats::EndRendered();
+	}
+}
+
+void FManipulatorToolsEditorEdMode::UpdateManipulatorFrame()
+{
+	if (ManipulatorFrameNumber == GFrameCounter)
+	{
+		return;
+	}
+	ManipulatorFrameElements.Reset();
+
 	// Update Sequencer Tracks
 	SelectedManipulators = NewSelectedManipulators;
 	SequencerUpdateTrackSelection();
 
 	// Update Visuals
+	TArray<FManipulatorHandle> VisibleManipulators;
+	TArray<FManipulatorHandle> Manipulators;
 	TArray<AActor*> SelectedActors;
 	GEditor->GetSelectedActors()->GetSelectedObjects(SelectedActors);
 	for(AActor* SelectedActor : SelectedActors)
@@ -85,182 +275,357 @@ void FManipulatorToolsEditorEdMode::Render(const FSceneView * View, FViewport *
 		// Make sure selected actor is valid AND that we don't have any components selects in the component list. 
 		if (IsValid(SelectedActor) && Owner->GetSelectedComponents()->Num() == 0)
 		{
-			TArray<UActorComponent*> Manipulators = SelectedActor->GetComponentsByClass(UManipulatorComponent::StaticClass());
-			for (UActorComponent* ActorComponent : Manipulators)
+			FManipulatorDescriptors::GetActorManipulators(SelectedActor, Manipulators);
+			for (const FManipulatorHandle& Manipulator : Manipulators)
 			{
-				UManipulatorComponent* ManipulatorComponent = Cast<UManipulatorComponent>(ActorComponent);
 				// Visibility also controls whether or not it will draw.
-				if (IsValid(ManipulatorComponent) && ManipulatorComponent->IsVisible())
+				if (Manipulator.IsValid() && Manipulator.GetComponent()->IsVisible())
 				{
-					//Handle Forced Selections and removals.
-					if(ManipulatorComponent->bShouldDeselect)
-					{
-						RemoveSelectedManipulator(ManipulatorComponent);
-						ManipulatorComponent->bShouldDeselect = false;
-						SequencerUpdateTrackSelection();
-                    }
-					if(ManipulatorComponent->bShouldSelect)
-					{
-						AddNewSelectedManipulator(ManipulatorComponent);
-						ManipulatorComponent->bShouldSelect = false;
-						SequencerUpdateTrackSelection();
-					}
-                    ManipulatorComponent->bIsManipulatorSelected = IsManipulatorSelected(ManipulatorComponent);
-					
-					FManipulatorData* ManipulatorData = GetManipulatorData(ManipulatorComponent);
-					
-					// Set Color Based off of selection, bools handle their selection a bit different. 
-					FLinearColor DrawColor = ManipulatorComponent->Settings.Draw.BaseColor;
-					if (ManipulatorComponent->GetManipulatorID() == ManipulatorData->ID || GetBoolPropertyValueFromManipulator(ManipulatorComponent))
-					{
-						DrawColor = ManipulatorComponent->Settings.Draw.SelectedColor;
-					}
+					VisibleManipulators.Add(Manipulator);
+				}
+			}
+		}
+	}
 
-					// Declaration of variables before drawing anything
-					FTransform WidgetTransform = GetManipulatorTransformWithOffsets(ManipulatorComponent);
-					
-					ESceneDepthPriorityGroup WidgetDepthPriority = ManipulatorComponent->Settings.Draw.Extras.DepthPriorityGroup;
-					float WidgetThickness = 1;
-					FTransform WidgetOverallSize = FTransform();
-					WidgetOverallSize.SetScale3D(FVector(ManipulatorComponent->Settings.Draw.OverallSize, ManipulatorComponent->Settings.Draw.OverallSize, ManipulatorComponent->Settings.Draw.OverallSize));
-
-					//Used for the offset based on zoom
-					float WidgetSizeMultiplier = 1;
-					if (ManipulatorComponent->Settings.Draw.Extras.UseZoomOffset)
-					{
-						const float ZoomFactor = FMath::Min<float>(View->ViewMatrices.GetProjectionMatrix().M[0][0], View->ViewMatrices.GetProjectionMatrix().M[1][1]);
-						WidgetSizeMultiplier = View->Project(WidgetTransform.GetTranslation()).W * 0.0065f / ZoomFactor;
-					}
+	// Manipulators attached to sockets on the same mesh get their sockets evaluated together.
+	TArray<UManipulatorComponent*> SocketManipulators;
+	for (const FManipulatorHandle& Manipulator : VisibleManipulators)
+	{
+		if (Manipulator.GetComponent()->GetDrawSettings().Extras.UseAttachedSocketAsInitialOffset)
+		{
+			SocketManipulators.Add(Manipulator.GetComponent());
+		}
+	}
+	TArray<FTransform> SocketTransforms;
+	UManipulatorComponent::GetAttachedSocketTransforms(SocketManipulators, SocketTransforms);
 
-					// Make HitProxy
-					HManipulatorProxy* HitProxy = new HManipulatorProxy(ManipulatorComponent);
+	int32 SocketIndex = 0;
+	for (const FManipulatorHandle& Manipulator : VisibleManipulators)
+	{
+		UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
+		const FTransform* AttachedSocketTransform = ManipulatorComponent->GetDrawSettings().Extras.UseAttachedSocketAsInitialOffset ? &SocketTransforms[SocketIndex++] : nullptr;
 
-					// ==========  WIRE BOX  ==========
-					for (FManipulatorSettingsMainDrawWireBox WireBox : ManipulatorComponent->GetAllShapesOfTypeWireBox())
-					{
-						
-						// Create Hit Proxy
-						PDI->SetHitProxy(HitProxy);
-						FTransform WireBoxTransform = WidgetTransform;
-						WireBoxTransform = HandleFinalShapeTransforms(ManipulatorComponent->CombineOffsetTransforms(WireBox.Offsets), WidgetOverallSize, WireBoxTransform);
-						FMatrix WidgetMatrix = WireBoxTransform.ToMatrixWithScale();
-
-						// Set Box Size
-						FBox BoxSize = WireBox.BoxSize;
-						BoxSize.Min = BoxSize.Min * WireBox.SizeMultiplier;
-						BoxSize.Max = BoxSize.Max * WireBox.SizeMultiplier;
-						WidgetThickness = WireBox.DrawThickness;
-						FLinearColor DrawBoxColor = DrawColor * WireBox.Color;
-
-						// Draw the box
-						
-						DrawWireBox(PDI, WidgetMatrix, BoxSize, DrawBoxColor, WidgetDepthPriority, WidgetThickness);
-					}
+		if (ManipulatorComponent->DrivesAllArrayElements())
+		{
+			// One component draws every element of the array, sharing its baked shapes between them.
+			TArray<FTransform> ElementTransforms;
+			GetManipulatorElementTransforms(Manipulator, ElementTransforms, AttachedSocketTransform);
 
-					// ==========  WIRE DIAMOND  ==========
-					for (FManipulatorSettingsMainDrawWireDiamond WireDiamond : ManipulatorComponent->GetAllShapesOfTypeWireDiamond())
-					{
-						// Create Hit Proxy
-						PDI->SetHitProxy(HitProxy);
-						FTransform WireDiamondTransform = WidgetTransform;
-						WireDiamondTransform = HandleFinalShapeTransforms(ManipulatorComponent->CombineOffsetTransforms(WireDiamond.Offsets), WidgetOverallSize, WireDiamondTransform);
-						FMatrix WidgetMatrix = WireDiamondTransform.ToMatrixWithScale();
+			bool bAnyElementSelected = false;
+			for (int32 ElementIndex = 0; ElementIndex < ElementTransforms.Num(); ElementIndex++)
+			{
+				const bool bIsElementSelected = IsManipulatorSelected(Manipulator, ElementIndex);
+				bAnyElementSelected |= bIsElementSelected;
+
+				FManipulatorFrameElement& Element = ManipulatorFrameElements[ManipulatorFrameElements.AddDefaulted()];
+				Element.Manipulator = Manipulator;
+				Element.PropertyIndex = ElementIndex;
+				Element.WidgetTransform = ElementTransforms[ElementIndex];
+				Element.DrawColor = bIsElementSelected ? ManipulatorComponent->GetDrawSettings().SelectedColor : ManipulatorComponent->GetDrawSettings().BaseColor;
+			}
+			// Declared manipulators share their settings object between actors so only components keep a selection state.
+			if (Manipulator.IsDeclared() == false)
+			{
+				ManipulatorComponent->SetManipulatorSelected(bAnyElementSelected);
+			}
+		}
+		else
+		{
+			const int32 PropertyIndex = ManipulatorComponent->Settings.Property.Index;
+			const bool bIsSelected = IsManipulatorSelected(Manipulator, PropertyIndex);
+			if (Manipulator.IsDeclared() == false)
+			{
+				ManipulatorComponent->SetManipulatorSelected(bIsSelected);
+			}
 
-						float DiamondSize = WireDiamond.Size * WidgetSizeMultiplier;
-						WidgetThickness = WireDiamond.DrawThickness;
-						FLinearColor DrawDiamondColor = DrawColor * WireDiamond.Color;
+			FTransform WidgetTransformNoPropertyOffset;
+			FManipulatorFrameElement& Element = ManipulatorFrameElements[ManipulatorFrameElements.AddDefaulted()];
+			Element.Manipulator = Manipulator;
+			Element.PropertyIndex = PropertyIndex;
+			Element.WidgetTransform = GetManipulatorTransformWithOffsets(Manipulator, PropertyIndex, WidgetTransformNoPropertyOffset, AttachedSocketTransform);
 
+			// Set Color Based off of selection, bools handle their selection a bit different. 
+			Element.DrawColor = ManipulatorComponent->GetDrawSettings().BaseColor;
+			if (bIsSelected || GetBoolPropertyValueFromManipulator(Manipulator))
+			{
+				Element.DrawColor = ManipulatorComponent->GetDrawSettings().SelectedColor;
+			}
+		}
+	}
 
-						DrawWireDiamond(PDI, WidgetMatrix, DiamondSize, DrawDiamondColor, WidgetDepthPriority, WidgetThickness);
+	// Only keep cached lines for what is drawn this frame, deselected actors, hidden manipulators, shrunk arrays and recreated components all drop out.
+	TSet<FManipulatorDrawCacheKey> FrameKeys;
+	FrameKeys.Reserve(ManipulatorFrameElements.Num());
+	for (const FManipulatorFrameElement& Element : ManipulatorFrameElements)
+	{
+		FManipulatorDrawCacheKey CacheKey;
+		CacheKey.Manipulator = Element.Manipulator;
+		CacheKey.PropertyIndex = Element.PropertyIndex;
+		FrameKeys.Add(CacheKey);
+	}
+	for (auto It = DrawCache.CreateIterator(); It; ++It)
+	{
+		if (FrameKeys.Contains(It.Key()) == false)
+		{
+			It.RemoveCurrent();
+		}
+	}
 
-					}
+	// Stamped last so nothing evaluated above can invalidate this frame's data.
+	ManipulatorFrameNumber = GFrameCounter;
+}
 
-					// ==========  PLANE  ==========
-					for (FManipulatorSettingsMainDrawPlane Plane : ManipulatorComponent->GetAllShapesOfTypePlane())
-					{
-						// Create Hit Proxy
-						PDI->SetHitProxy(HitProxy);
-						FTransform PlaneTransform = WidgetTransform;
-						PlaneTransform = HandleFinalShapeTransforms(ManipulatorComponent->CombineOffsetTransforms(Plane.Offsets), WidgetOverallSize, PlaneTransform, true);
-						FMatrix WidgetMatrix = PlaneTransform.ToMatrixWithScale();
+void FManipulatorToolsEditorEdMode::HandleSelectionRequests()
+{
+	TArray<FManipulatorSelectionRequest> SelectionRequests;
+	UManipulatorComponent::TakeSelectionRequests(SelectionRequests);
+
+	bool bSelectionChanged = false;
+	for (const FManipulatorSelectionRequest& Request : SelectionRequests)
+	{
+		UManipulatorComponent* ManipulatorComponent = Request.Component.Get();
+		if (IsValid(ManipulatorComponent) == false)
+		{
+			continue;
+		}
 
-						float PlaneSize = Plane.Size;
-						float UVMin = Plane.UVMin;
-						float UVMax = Plane.UVMax;
+		// Requests wait until the manipulator is actually being drawn for a selected actor.
+		const FManipulatorHandle Manipulator(ManipulatorComponent);
+		AActor* ManipulatorOwner = Manipulator.GetActor();
+		if (IsValid(ManipulatorOwner) == false || !ManipulatorOwner->IsSelected() || Owner->GetSelectedComponents()->Num() != 0 || !ManipulatorComponent->IsVisible())
+		{
+			UManipulatorComponent::QueueSelectionRequest(ManipulatorComponent, Request.Select);
+			continue;
+		}
 
-						if (IsValid(Plane.Material) == false)
-						{
-							FString MaterialPath = "/ManipulatorTools/HardCoded/MM_ManipulatorTools_ShapePlane.MM_ManipulatorTools_ShapePlane";
-							Plane.Material = (UMaterial*)StaticLoadObject(UMaterial::StaticClass(), NULL, *MaterialPath, NULL, LOAD_None, NULL);
-						}
-						UMaterialInterface* Material = Plane.Material;
-						UMaterialInstanceDynamic* MaterialInstanceDynamic = UMaterialInstanceDynamic::Create(Material, NULL);
+		if (Request.Select)
+		{
+			AddNewSelectedManipulator(Manipulator, ManipulatorComponent->Settings.Property.Index);
+			ManipulatorComponent->bShouldSelect = false;
+		}
+		else
+		{
+			RemoveSelectedManipulator(Manipulator, ManipulatorComponent->Settings.Property.Index);
+			ManipulatorComponent->bShouldDeselect = false;
+		}
+		bSelectionChanged = true;
+	}
 
-						FLinearColor DrawPlaneColor = DrawColor * Plane.Color;
+	if (bSelectionChanged)
+	{
+		SequencerUpdateTrackSelection();
+	}
+}
+
+void FManipulatorToolsEditorEdMode::InvalidateManipulatorFrame()
+{
+	ManipulatorFrameNumber = MAX_uint64;
+}
 
-						MaterialInstanceDynamic->SetVectorParameterValue(FName("DrawColor"), DrawPlaneColor);
+void FManipulatorToolsEditorEdMode::DrawManipulator(const FSceneView* View, FPrimitiveDrawInterface* PDI, const FManipulatorHandle& Manipulator, int32 PropertyIndex, const FTransform& WidgetTransform, const FLinearColor& DrawColor)
+{
+	UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
+	ESceneDepthPriorityGroup WidgetDepthPriority = ManipulatorComponent->GetDrawSettings().Extras.DepthPriorityGroup;
+
+	//Used for the offset based on zoom
+	float WidgetSizeMultiplier = 1;
+	if (ManipulatorComponent->GetDrawSettings().Extras.UseZoomOffset)
+	{
+		const float ZoomFactor = FMath::Min<float>(View->ViewMatrices.GetProjectionMatrix().M[0][0], View->ViewMatrices.GetProjectionMatrix().M[1][1]);
+		WidgetSizeMultiplier = View->Project(WidgetTransform.GetTranslation()).W * 0.0065f / ZoomFactor;
+	}
+
+	// Make HitProxy
+	HManipulatorProxy* HitProxy = new HManipulatorProxy(Manipulator, PropertyIndex);
+	PDI->SetHitProxy(HitProxy);
+
+	// Only regenerate the wire lines when something they depend on has changed, most manipulators sit still between frames.
+	FManipulatorDrawCacheKey CacheKey;
+	CacheKey.Manipulator = Manipulator;
+	CacheKey.PropertyIndex = PropertyIndex;
+	FManipulatorDrawCache& Cache = DrawCache.FindOrAdd(CacheKey);
+	if (Cache.SettingsVersion != ManipulatorComponent->GetSettingsVersion()
+		|| Cache.DrawColor != DrawColor
+		|| !Cache.WidgetTransform.Equals(WidgetTransform, 0.0f))
+	{
+		BuildManipulatorLines(ManipulatorComponent, WidgetTransform, DrawColor, Cache);
+	}
+
+	// The zoom multiplier is different in every viewport so it's applied here rather than baked into the cache.
+	for (const FManipulatorDrawLine& Line : Cache.Lines)
+	{
+		if (Line.bScaleWithZoom && WidgetSizeMultiplier != 1.0f)
+		{
+			PDI->DrawLine(Line.Pivot + (Line.Start - Line.Pivot) * WidgetSizeMultiplier, Line.Pivot + (Line.End - Line.Pivot) * WidgetSizeMultiplier, Line.Color, WidgetDepthPriority, Line.Thickness);
+		}
+		else
+		{
+			PDI->DrawLine(Line.Start, Line.End, Line.Color, WidgetDepthPriority, Line.Thickness);
+		}
+	}
+
+	// Planes are meshes rather than lines so they're always drawn.
+	for (const FManipulatorDrawShape& Shape : ManipulatorComponent->GetDrawShapes())
+	{
+		if (Shape.Type != EManipulatorPropertyDrawType::MDT_PLANE)
+		{
+			continue;
+		}
+
+		const FLinearColor ShapeColor = DrawColor * Shape.Color;
+		FTransform PlaneTransform = HandleFinalShapeTransform(Shape.LocalTransform, WidgetTransform, true);
+
+		UMaterialInterface* Material = Shape.Material.Get();
+		if (IsValid(Material) == false)
+		{
+			FString MaterialPath = "/ManipulatorTools/HardCoded/MM_ManipulatorTools_ShapePlane.MM_ManipulatorTools_ShapePlane";
+			Material = (UMaterial*)StaticLoadObject(UMaterial::StaticClass(), NULL, *MaterialPath, NULL, LOAD_None, NULL);
+		}
+		UMaterialInstanceDynamic* MaterialInstanceDynamic = UMaterialInstanceDynamic::Create(Material, NULL);
+		MaterialInstanceDynamic->SetVectorParameterValue(FName("DrawColor"), ShapeColor);
 #if ENGINE_MAJOR_VERSION >= 4 && ENGINE_MINOR_VERSION > 21
-						FMaterialRenderProxy* RenderProxy = MaterialInstanceDynamic->GetRenderProxy();
+		FMaterialRenderProxy* RenderProxy = MaterialInstanceDynamic->GetRenderProxy();
 #else
-						FMaterialRenderProxy* RenderProxy = MaterialInstanceDynamic->GetRenderProxy(false);
+		FMaterialRenderProxy* RenderProxy = MaterialInstanceDynamic->GetRenderProxy(false);
 #endif
-						DrawPlane10x10(PDI, WidgetMatrix, PlaneSize, FVector2D(UVMin, UVMin), FVector2D(UVMax, UVMax), RenderProxy, WidgetDepthPriority);
-					}
+		const FManipulatorPlaneMesh& PlaneMesh = GetPlaneMesh(Shape.NumSides, Shape.UVRange);
+		FDynamicMeshBuilder MeshBuilder(PDI->View->GetFeatureLevel());
+		MeshBuilder.AddVertices(PlaneMesh.Vertices);
+		MeshBuilder.AddTriangles(PlaneMesh.Indices);
+		MeshBuilder.Draw(PDI, FScaleMatrix(Shape.Size) * PlaneTransform.ToMatrixWithScale(), RenderProxy, WidgetDepthPriority);
+	}
+}
+
+const FManipulatorPlaneMesh& FManipulatorToolsEditorEdMode::GetPlaneMesh(int32 NumTiles, const FVector2D& UVRange)
+{
+	FManipulatorPlaneMeshKey Key;
+	Key.NumTiles = FMath::Max(NumTiles, 1);
+	Key.UVRange = UVRange;
+	if (const FManipulatorPlaneMesh* PlaneMesh = PlaneMeshes.Find(Key))
+	{
+		return *PlaneMesh;
+	}
 
-					// ==========  CIRCLE  ==========
-					for (FManipulatorSettingsMainDrawCircle Circle : ManipulatorComponent->GetAllShapesOfTypeWireCircle())
+	// Same layout DrawPlane10x10 builds on every call, a grid of quads over -1 to 1 with the UV range stretched across it, but with shared corners.
+	FManipulatorPlaneMesh& PlaneMesh = PlaneMeshes.Add(Key);
+	const uint32 NumVerticesPerSide = Key.NumTiles + 1;
+	for (uint32 Y = 0; Y < NumVerticesPerSide; Y++)
+	{
+		const float AlphaY = (float)Y / Key.NumTiles;
+		for (uint32 X = 0; X < NumVerticesPerSide; X++)
+		{
+			const float AlphaX = (float)X / Key.NumTiles;
+			const FVector Position(AlphaX * 2.0f - 1.0f, AlphaY * 2.0f - 1.0f, 0.0f);
+			const FVector2D TexCoord(FMath::Lerp(UVRange.X, UVRange.Y, AlphaX), FMath::Lerp(UVRange.X, UVRange.Y, AlphaY));
+			PlaneMesh.Vertices.Add(FDynamicMeshVertex(Position, FVector(1, 0, 0), FVector(0, 0, 1), TexCoord, FColor::White));
+		}
+	}
+	for (uint32 Y = 0; Y + 1 < NumVerticesPerSide; Y++)
+	{
+		for (uint32 X = 0; X + 1 < NumVerticesPerSide; X++)
+		{
+			const uint32 Corner = Y * NumVerticesPerSide + X;
+			// Wound the same way as DrawPlane10x10 so the plane faces the same side.
+			PlaneMesh.Indices.Append({ Corner, Corner + NumVerticesPerSide, Corner + NumVerticesPerSide + 1 });
+			PlaneMesh.Indices.Append({ Corner, Corner + NumVerticesPerSide + 1, Corner + 1 });
+		}
+	}
+	return PlaneMesh;
+}
+
+void FManipulatorToolsEditorEdMode::BuildManipulatorLines(UManipulatorComponent* ManipulatorComponent, const FTransform& WidgetTransform, const FLinearColor& DrawColor, FManipulatorDrawCache& Cache) const
+{
+	Cache.SettingsVersion = ManipulatorComponent->GetSettingsVersion();
+	Cache.WidgetTransform = WidgetTransform;
+	Cache.DrawColor = DrawColor;
+	Cache.Lines.Reset();
+
+	// Same lines DrawWireBox, DrawWireDiamond and DrawCircle would emit, just kept around instead of sent straight to the PDI.
+	for (const FManipulatorDrawShape& Shape : ManipulatorComponent->GetDrawShapes())
+	{
+		const FLinearColor ShapeColor = DrawColor * Shape.Color;
+		switch (Shape.Type)
+		{
+		case EManipulatorPropertyDrawType::MDT_BOXWIRE:
+		{
+			const FMatrix BoxMatrix = HandleFinalShapeTransform(Shape.LocalTransform, WidgetTransform).ToMatrixWithScale();
+			const FBox Box(Shape.VectorA, Shape.VectorB);
+			FVector Corners[8];
+			for (int32 CornerIndex = 0; CornerIndex < 8; CornerIndex++)
+			{
+				const FVector Corner((CornerIndex & 1) ? Box.Max.X : Box.Min.X, (CornerIndex & 2) ? Box.Max.Y : Box.Min.Y, (CornerIndex & 4) ? Box.Max.Z : Box.Min.Z);
+				Corners[CornerIndex] = BoxMatrix.TransformPosition(Corner);
+			}
+			// Corners that differ by a single bit share an edge.
+			for (int32 CornerIndex = 0; CornerIndex < 8; CornerIndex++)
+			{
+				for (int32 Bit = 1; Bit < 8; Bit <<= 1)
+				{
+					if ((CornerIndex & Bit) == 0)
 					{
-						// Create Hit Proxy
-						PDI->SetHitProxy(HitProxy);
-						FTransform CircleTransform = WidgetTransform;
-						CircleTransform = HandleFinalShapeTransforms(ManipulatorComponent->CombineOffsetTransforms(Circle.Offsets), WidgetOverallSize, CircleTransform);
-
-						FVector X = CircleTransform.GetRotation().RotateVector(Circle.Rotation.RotateVector(FVector(1, 0, 0)) * CircleTransform.GetScale3D());
-						FVector Y = CircleTransform.GetRotation().RotateVector(Circle.Rotation.RotateVector(FVector(0, 1, 0)) * CircleTransform.GetScale3D());
-						float Radius = Circle.Radius;
-						float NumSides = Circle.NumSides;
-						WidgetThickness = Circle.DrawThickness;
-						FLinearColor DrawCircleColor = DrawColor * Circle.Color;
-
-						DrawCircle(PDI, CircleTransform.GetLocation(), X, Y, DrawCircleColor, Radius, NumSides, WidgetDepthPriority, WidgetThickness, 0, false);
+						Cache.Lines.Add({ Corners[CornerIndex], Corners[CornerIndex | Bit], ShapeColor, Shape.Thickness, false, FVector::ZeroVector });
 					}
 				}
 			}
+			break;
+		}
+		case EManipulatorPropertyDrawType::MDT_DIAMONDWIRE:
+		{
+			const FMatrix DiamondMatrix = HandleFinalShapeTransform(Shape.LocalTransform, WidgetTransform).ToMatrixWithScale();
+			// Built at a multiplier of 1, the points are scaled about the diamond's origin per view when drawn.
+			const FVector Pivot = DiamondMatrix.GetOrigin();
+			const float Size = Shape.Size;
+			const float OneOverRootTwo = FMath::Sqrt(0.5f);
+			const FVector TopPoint = DiamondMatrix.TransformPosition(FVector(0, 0, 1) * Size);
+			const FVector BottomPoint = DiamondMatrix.TransformPosition(FVector(0, 0, -1) * Size);
+			const FVector SquarePoints[4] =
+			{
+				DiamondMatrix.TransformPosition(FVector(1, 1, 0) * Size * OneOverRootTwo),
+				DiamondMatrix.TransformPosition(FVector(-1, 1, 0) * Size * OneOverRootTwo),
+				DiamondMatrix.TransformPosition(FVector(-1, -1, 0) * Size * OneOverRootTwo),
+				DiamondMatrix.TransformPosition(FVector(1, -1, 0) * Size * OneOverRootTwo)
+			};
+			for (int32 PointIndex = 0; PointIndex < 4; PointIndex++)
+			{
+				Cache.Lines.Add({ TopPoint, SquarePoints[PointIndex], ShapeColor, Shape.Thickness, true, Pivot });
+				Cache.Lines.Add({ BottomPoint, SquarePoints[PointIndex], ShapeColor, Shape.Thickness, true, Pivot });
+				Cache.Lines.Add({ SquarePoints[PointIndex], SquarePoints[(PointIndex + 1) % 4], ShapeColor, Shape.Thickness, true, Pivot });
+			}
+			break;
+		}
+		case EManipulatorPropertyDrawType::MDT_CIRCLE:
+		{
+			FTransform CircleTransform = HandleFinalShapeTransform(Shape.LocalTransform, WidgetTransform);
+			const FVector Base = CircleTransform.GetLocation();
+			const FVector X = CircleTransform.GetRotation().RotateVector(Shape.VectorA * CircleTransform.GetScale3D());
+			const FVector Y = CircleTransform.GetRotation().RotateVector(Shape.VectorB * CircleTransform.GetScale3D());
+			const int32 NumSides = FMath::Max(Shape.NumSides, 1);
+			const float AngleDelta = 2.0f * PI / NumSides;
+			FVector LastVertex = Base + X * Shape.Size;
+			for (int32 SideIndex = 0; SideIndex < NumSides; SideIndex++)
+			{
+				const FVector Vertex = Base + (X * FMath::Cos(AngleDelta * (SideIndex + 1)) + Y * FMath::Sin(AngleDelta * (SideIndex + 1))) * Shape.Size;
+				Cache.Lines.Add({ LastVertex, Vertex, ShapeColor, Shape.Thickness, false, FVector::ZeroVector });
+				LastVertex = Vertex;
+			}
+			break;
+		}
+		default:
+			break;
 		}
 	}
-	FEdMode::Render(View, Viewport, PDI);
 }
 
 bool FManipulatorToolsEditorEdMode::HandleClick(FEditorViewportClient * InViewportClient, HHitProxy * HitProxy, const FViewportClick & Click)
 {
-	// Sets the current edited component to look at when clicked we have to name match because components 
+	// Sets the current edited component to look at when clicked. Selections remember the manipulator id rather than the component because components
 	// get destroyed and recreated on construct making it impossible to just simply hard reference it.
 	if (HitProxy != nullptr && HitProxy->IsA(HManipulatorProxy::StaticGetType()))
 	{
 		HManipulatorProxy* PropertyProxy = (HManipulatorProxy*)HitProxy;
-		//Handle Toggling Bool on and Off.
-		if (PropertyProxy->ManipulatorComponent->Settings.Property.Type == EManipulatorPropertyType::MT_BOOL)
+		if (PropertyProxy->Manipulator.IsValid())
 		{
-			ToggleBoolPropertyValueFromManipulator(PropertyProxy->ManipulatorComponent);
-			ResetDeSelectCounter();
-		}
-		else
-		{
-			if (Click.IsControlDown())
-			{
-				ToggleSelectedManipulator(PropertyProxy->ManipulatorComponent);
-			}
-			else if (Click.IsShiftDown())
-			{
-				AddNewSelectedManipulator(PropertyProxy->ManipulatorComponent);
-			}
-			else
-			{
-				ClearManipulatorSelection();
-				AddNewSelectedManipulator(PropertyProxy->ManipulatorComponent);
-			}
-			AllowTrackSelectionUpdate = true;
-			ResetDeSelectCounter();
+			ClickManipulator(PropertyProxy->Manipulator, PropertyProxy->PropertyIndex, Click.IsControlDown(), Click.IsShiftDown());
 		}
 		return true;
 	}
@@ -279,18 +644,62 @@ bool FManipulatorToolsEditorEdMode::HandleClick(FEditorViewportClient * InViewpo
 	return false;
 }
 
+void FManipulatorToolsEditorEdMode::ClickManipulator(const FManipulatorHandle& Manipulator, int32 PropertyIndex, bool bControlDown, bool bShiftDown)
+{
+	if (FManipulatorLatencyStats::IsEnabled())
+	{
+		FManipulatorLatencyStats::BeginUntilRendered(EManipulatorLatencyStat::ClickToVisible, FPlatformTime::Cycles64());
+	}
+	if (InputRecording.IsValid())
+	{
+		FManipulatorInputEvent Event;
+		Event.Type = EManipulatorInputEventType::Click;
+		Event.Target.ManipulatorGuid = Manipulator.Guid;
+		Event.Target.PropertyIndex = PropertyIndex;
+		Event.bControlDown = bControlDown;
+		Event.bShiftDown = bShiftDown;
+		RecordInputEvent(Event);
+	}
+
+	//Handle Toggling Bool on and Off.
+	if (Manipulator.GetComponent()->Settings.Property.Type == EManipulatorPropertyType::MT_BOOL)
+	{
+		const FScopedTransaction Transaction(LOCTEXT("ToggleManipulatorBool", "Toggle Manipulator"));
+		ToggleBoolPropertyValueFromManipulator(Manipulator);
+		ResetDeSelectCounter();
+	}
+	else
+	{
+		if (bControlDown)
+		{
+			ToggleSelectedManipulator(Manipulator, PropertyIndex);
+		}
+		else if (bShiftDown)
+		{
+			AddNewSelectedManipulator(Manipulator, PropertyIndex);
+		}
+		else
+		{
+			ClearManipulatorSelection();
+			AddNewSelectedManipulator(Manipulator, PropertyIndex);
+		}
+		AllowTrackSelectionUpdate = true;
+		ResetDeSelectCounter();
+	}
+}
+
 FVector FManipulatorToolsEditorEdMode::GetWidgetLocation() const
 {
 	// Update the widget location so that it doesn't leave you with odd relative offset stuff.
-	UManipulatorComponent* ManipulatorComponent = NewObject<UManipulatorComponent>();
+	FManipulatorHandle Manipulator;
 	FTransform WidgetTransform = FTransform::Identity;
 	if (SelectedManipulators.Num() > 0)
 	{
-		if (GetSelectedManipulatorComponent(SelectedManipulators.Last(), ManipulatorComponent))
+		if (GetSelectedManipulator(SelectedManipulators.Last(), Manipulator))
 		{
 			FVector WorldLocation = Owner->PivotLocation;
 			// Handle Enum property offsets
-			WidgetTransform = GetManipulatorTransformWithOffsets(ManipulatorComponent);
+			WidgetTransform = GetManipulatorTransformWithOffsets(Manipulator, SelectedManipulators.Last()->PropertyIndex);
 			// Do some crazy magical shit to offset the widget location
 			WorldLocation = WidgetTransform.GetLocation();
 			return WorldLocation;
@@ -302,66 +711,76 @@ FVector FManipulatorToolsEditorEdMode::GetWidgetLocation() const
 
 bool FManipulatorToolsEditorEdMode::InputDelta(FEditorViewportClient* InViewportClient, FViewport* InViewport, FVector & InDrag, FRotator & InRot, FVector & InScale)
 {
+	if (ApplyManipulatorInputDelta(InViewportClient->GetCurrentWidgetAxis(), InDrag, InRot, InScale))
+	{
+		return true;
+	}
+
+	FEdMode::InputDelta(InViewportClient, InViewport, InDrag, InRot, InScale);
+	return false;
+}
+
+bool FManipulatorToolsEditorEdMode::ApplyManipulatorInputDelta(EAxisList::Type Axis, const FVector& InDrag, const FRotator& InRot, const FVector& InScale)
+{
+	const uint64 InputStartCycles = FManipulatorLatencyStats::IsEnabled() ? FPlatformTime::Cycles64() : 0;
+	if (InputRecording.IsValid() && DragTransaction.IsValid())
+	{
+		FManipulatorInputEvent Event;
+		Event.Type = EManipulatorInputEventType::Delta;
+		Event.Axis = Axis;
+		Event.Drag = InDrag;
+		Event.Rot = InRot;
+		Event.Scale = InScale;
+		RecordInputEvent(Event);
+	}
+
 	bool IsDragging = InDrag.IsZero();
 	bool IsRotating = InRot.IsZero();
 	bool IsScaling = InScale.IsZero();
 
 	// The input delta is what tells the widget how much to adjust its value by based on user input. 
-	UManipulatorComponent* ManipulatorComponent;
+	FManipulatorHandle Manipulator;
 	FTransform WidgetTransform = FTransform::Identity;
+	TArray<FManipulatorEdit> PendingEdits;
 	for (FManipulatorData* ManipulatorData : SelectedManipulators)
 	{
-		if (GetSelectedManipulatorComponent(ManipulatorData, ManipulatorComponent) && InViewportClient->GetCurrentWidgetAxis() != EAxisList::None)
+		if (GetSelectedManipulator(ManipulatorData, Manipulator) && Axis != EAxisList::None)
 		{
 			// Get the object to edit properties is the only way I could correctly get something that talked nicely to the get property value by name. 
-			UObject* ObjectToEditProperties = GetObjectToDisplayWidgetsFromManipulator(ManipulatorComponent);
-			if (IsValid(ObjectToEditProperties) && IsValid(ManipulatorComponent) && IsValid(ManipulatorComponent->GetOwner()) && IsValid(ManipulatorComponent->GetOwner()->GetRootComponent()))
+			UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
+			UObject* ObjectToEditProperties = GetObjectToDisplayWidgetsFromManipulator(Manipulator);
+			if (IsValid(ObjectToEditProperties) && IsValid(Manipulator.GetActor()->GetRootComponent()))
 			{
 				FTransform WidgetTransformNoPropertyOffset = FTransform::Identity;
-				WidgetTransform = GetManipulatorTransformWithOffsets(ManipulatorComponent, WidgetTransformNoPropertyOffset);
-				USceneComponent* RootComponent = ManipulatorComponent->GetOwner()->GetRootComponent();
+				WidgetTransform = GetManipulatorTransformWithOffsets(Manipulator, ManipulatorData->PropertyIndex, WidgetTransformNoPropertyOffset);
+				USceneComponent* RootComponent = Manipulator.GetActor()->GetRootComponent();
 				// Not sure what this does.. but i kept it.
 				GEditor->NoteActorMovement();
 
-				if (!ManipulatorData->PropertyName.IsEmpty())
+				const FManipulatorPropertyHandler& PropertyHandler = GetManipulatorPropertyHandler(ManipulatorComponent->Settings.Property.Type);
+				if (!ManipulatorData->PropertyName.IsEmpty() && PropertyHandler.bUsesWidget)
 				{
 					FTransform PropertyTransform = FTransform::Identity;
-					FTransform NewTM = FTransform::Identity;
-					FVector LocalLocation = FVector();
-					uint8 EnumValue = 0;
+					FVector WidgetOffset = FVector::ZeroVector;
 
 					FTransform DeltaTransform = FTransform(InRot, InDrag, InScale);
-					float CurrentFloat = 0;
 
-					// Get the property values based off of their type on the component and the name on the component.
-					switch (ManipulatorComponent->Settings.Property.Type)
-					{
-					case EManipulatorPropertyType::MT_TRANSFORM:
-						// Get Property Here
-						PropertyTransform = GetPropertyValueByName<FTransform>(ObjectToEditProperties, ManipulatorData->PropertyName, ManipulatorData->PropertyIndex);
-						break;
-					case EManipulatorPropertyType::MT_VECTOR:
-						LocalLocation = GetPropertyValueByName<FVector>(ObjectToEditProperties, ManipulatorData->PropertyName, ManipulatorData->PropertyIndex);
-						PropertyTransform = FTransform(LocalLocation);
-						break;
-					case EManipulatorPropertyType::MT_ENUM:
-						EnumValue = GetPropertyValueByName<uint8>(ObjectToEditProperties, ManipulatorData->PropertyName, ManipulatorData->PropertyIndex);
-						break;
-					}
+					// Get the property value as a transform, enums stay at identity so the drag distance can be snapped to steps.
+					PropertyHandler.Read(ObjectToEditProperties, ManipulatorComponent->Settings.Property, ManipulatorData->PropertyIndex, PropertyTransform, WidgetOffset);
 					
 					// Flip Transforms if told to flip X
-					PropertyTransform = FlipTransformOnX(PropertyTransform, ManipulatorComponent->Settings.Draw.Extras.FlipVisualXLocation, ManipulatorComponent->Settings.Draw.Extras.FlipVisualYRotation, ManipulatorComponent->Settings.Draw.Extras.FlipVisualXScale);
+					PropertyTransform = FlipTransformOnX(PropertyTransform, ManipulatorComponent->GetDrawSettings().Extras.FlipVisualXLocation, ManipulatorComponent->GetDrawSettings().Extras.FlipVisualYRotation, ManipulatorComponent->GetDrawSettings().Extras.FlipVisualXScale);
 
 					// Actor Transform is essentially the reference point for which the manipulator will use to do its calculations. We move this point as needed per usage
 					FTransform ActorTransform = WidgetTransformNoPropertyOffset;
 					FTransform PropertyTransformWithDelta = PropertyTransform;
 
 					// Handle Custom Actions When Adjusting things
-					if (ManipulatorComponent->Settings.Draw.Extras.UseAttachedSocketAsInitialOffset)
+					if (ManipulatorComponent->GetDrawSettings().Extras.UseAttachedSocketAsInitialOffset)
 					{
 					//	ActorTransform = PropertyTransform.Inverse() * ManipulatorComponent->GetComponentTransform();
 					}
-					else if (ManipulatorComponent->Settings.Draw.Extras.UsePropertyValueAsInitialOffset == false)
+					else if (ManipulatorComponent->GetDrawSettings().Extras.UsePropertyValueAsInitialOffset == false)
 					{
 						ActorTransform = FTransform::Identity;
 					}
@@ -378,49 +797,133 @@ bool FManipulatorToolsEditorEdMode::InputDelta(FEditorViewportClient* InViewport
 
 					// Apply delta scale
 					PropertyTransformWithDelta.SetScale3D(PropertyTransform.GetScale3D() + DeltaTransform.GetScale3D());
+					const FTransform VisualTransformWithDelta = PropertyTransformWithDelta;
 
 					// Flip Transform Back so the values are correct
-					PropertyTransformWithDelta = FlipTransformOnX(PropertyTransformWithDelta, ManipulatorComponent->Settings.Draw.Extras.FlipVisualXLocation, ManipulatorComponent->Settings.Draw.Extras.FlipVisualYRotation, ManipulatorComponent->Settings.Draw.Extras.FlipVisualXScale);
+					PropertyTransformWithDelta = FlipTransformOnX(PropertyTransformWithDelta, ManipulatorComponent->GetDrawSettings().Extras.FlipVisualXLocation, ManipulatorComponent->GetDrawSettings().Extras.FlipVisualYRotation, ManipulatorComponent->GetDrawSettings().Extras.FlipVisualXScale);
 
 					// Constrain
 					PropertyTransformWithDelta = ManipulatorComponent->ConstrainTransform(PropertyTransformWithDelta);
 
-					// Prepare for editing
-					ObjectToEditProperties->PreEditChange(NULL);
-					UProperty* SetProperty = NULL;
+					// Queue the write, everything is applied together once every selected manipulator has been worked out.
+					FManipulatorEdit Edit;
+					Edit.Object = ObjectToEditProperties;
+					Edit.Property = ManipulatorComponent->Settings.Property;
+					Edit.PropertyIndex = ManipulatorData->PropertyIndex;
+					Edit.Value = PropertyTransformWithDelta;
+					PendingEdits.Add(Edit);
 
-					// Set the property values based off of their type on the component and the name on the component.
-					switch (ManipulatorComponent->Settings.Property.Type)
+					if (bUseMirrorEditing)
 					{
-					case EManipulatorPropertyType::MT_TRANSFORM:
-						// Get Property Here
-						SetPropertyValueByName<FTransform>(ObjectToEditProperties, ManipulatorData->PropertyName, ManipulatorData->PropertyIndex, PropertyTransformWithDelta, SetProperty);
-						break;
-					case EManipulatorPropertyType::MT_VECTOR:
-						SetPropertyValueByName<FVector>(ObjectToEditProperties, ManipulatorData->PropertyName, ManipulatorData->PropertyIndex, PropertyTransformWithDelta.GetLocation(), SetProperty);
-						break;
-					case EManipulatorPropertyType::MT_ENUM:
-						//Handle Enum Change
-						EnumValue = HandleEnumPropertyInputDelta(ManipulatorComponent, PropertyTransformWithDelta, EnumValue);
-						SetPropertyValueByName<uint8>(ObjectToEditProperties, ManipulatorData->PropertyName, ManipulatorData->PropertyIndex, EnumValue, SetProperty);
-						break;
+						QueueMirroredEdit(Manipulator, ManipulatorData->PropertyIndex, PropertyTransform, VisualTransformWithDelta, PendingEdits);
 					}
+				}
+			}
+		}
+	}
 
-					SequencerKeyProperty(ObjectToEditProperties, SetProperty);
+	if (ApplyManipulatorEdits(PendingEdits))
+	{
+		if (InputStartCycles != 0)
+		{
+			FManipulatorLatencyStats::BeginUntilRendered(EManipulatorLatencyStat::DragToVisible, InputStartCycles);
+		}
+		bDragChangedProperties = true;
+		InvalidateManipulatorFrame();
+		ResetDeSelectCounter();
+		return true;
+	}
+	return false;
+}
 
-					FPropertyChangedEvent PropertyChangeEvent(SetProperty);
-					ObjectToEditProperties->PostEditChangeProperty(PropertyChangeEvent);
-					ResetDeSelectCounter();
-					if (ManipulatorData == SelectedManipulators.Last())
-					{
-						return true;
-					}
+bool FManipulatorToolsEditorEdMode::StartTracking(FEditorViewportClient* InViewportClient, FViewport* InViewport)
+{
+	if (BeginManipulatorDrag(InViewportClient->GetCurrentWidgetAxis()))
+	{
+		return true;
+	}
+	return FEdMode::StartTracking(InViewportClient, InViewport);
+}
+
+bool FManipulatorToolsEditorEdMode::BeginManipulatorDrag(EAxisList::Type Axis)
+{
+	// Open one transaction for the whole drag and snapshot every object the selected manipulators edit up front.
+	// Later Modify calls from the same gesture are ignored by the transaction so mouse moves don't record anything.
+	if (!DragTransaction.IsValid() && SelectedManipulators.Num() > 0 && Axis != EAxisList::None)
+	{
+		if (InputRecording.IsValid())
+		{
+			FManipulatorInputEvent Event;
+			Event.Type = EManipulatorInputEventType::BeginDrag;
+			Event.Axis = Axis;
+			for (const FManipulatorData* ManipulatorData : SelectedManipulators)
+			{
+				FManipulatorInputSelection& Selection = Event.Selection[Event.Selection.AddDefaulted()];
+				Selection.ManipulatorGuid = ManipulatorData->ManipulatorGuid;
+				Selection.PropertyIndex = ManipulatorData->PropertyIndex;
+			}
+			RecordInputEvent(Event);
+		}
+
+		DragTransaction = MakeUnique<FScopedTransaction>(LOCTEXT("DragManipulator", "Drag Manipulator"));
+		bDragChangedProperties = false;
+
+		// Components may have been added or renamed since the last drag so pairs are worked out again on first use.
+		MirrorPartners.Reset();
+
+		FManipulatorHandle Manipulator;
+		for (FManipulatorData* ManipulatorData : SelectedManipulators)
+		{
+			if (GetSelectedManipulator(ManipulatorData, Manipulator))
+			{
+				UObject* ObjectToEditProperties = GetObjectToDisplayWidgetsFromManipulator(Manipulator);
+				if (IsValid(ObjectToEditProperties))
+				{
+					ObjectToEditProperties->Modify();
 				}
 			}
 		}
+		return true;
 	}
+	return false;
+}
 
-	FEdMode::InputDelta(InViewportClient, InViewport, InDrag, InRot, InScale);
+bool FManipulatorToolsEditorEdMode::EndTracking(FEditorViewportClient* InViewportClient, FViewport* InViewport)
+{
+	if (EndManipulatorDrag())
+	{
+		return true;
+	}
+	return FEdMode::EndTracking(InViewportClient, InViewport);
+}
+
+bool FManipulatorToolsEditorEdMode::EndManipulatorDrag()
+{
+	if (DragTransaction.IsValid())
+	{
+		if (InputRecording.IsValid())
+		{
+			FManipulatorInputEvent Event;
+			Event.Type = EManipulatorInputEventType::EndDrag;
+			RecordInputEvent(Event);
+		}
+
+		// Key whatever the last frame of the drag changed and tidy up the keys while the drag's transaction is still open.
+		FlushPendingKeys();
+		if (bReduceKeysOnRelease && bDragChangedProperties)
+		{
+			ReduceDragKeys();
+		}
+		DragKeyedProperties.Reset();
+
+		// Clicking the widget without moving it shouldn't leave an empty undo entry behind.
+		if (!bDragChangedProperties)
+		{
+			DragTransaction->Cancel();
+		}
+		DragTransaction.Reset();
+		return true;
+	}
 	return false;
 }
 
@@ -432,29 +935,20 @@ bool FManipulatorToolsEditorEdMode::AllowWidgetMove()
 bool FManipulatorToolsEditorEdMode::GetCustomDrawingCoordinateSystem(FMatrix& InMatrix, void* InData)
 {
 	// Mostly copied code from EdMode to make Transforms correctly display their custom axis information when editing.
-	UManipulatorComponent* ManipulatorComponent = NewObject<UManipulatorComponent>();
+	FManipulatorHandle Manipulator;
 	if (SelectedManipulators.Num() > 0)
 	{
-		if (GetSelectedManipulatorComponent(SelectedManipulators.Last(), ManipulatorComponent))
+		if (GetSelectedManipulator(SelectedManipulators.Last(), Manipulator))
 		{			
-			UObject* BestSelectedItem = GetObjectToDisplayWidgetsFromManipulator(ManipulatorComponent);
+			UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
+			UObject* BestSelectedItem = GetObjectToDisplayWidgetsFromManipulator(Manipulator);
 			if (BestSelectedItem && ManipulatorComponent->Settings.Property.NameToEdit != TEXT(""))
 			{
-				FTransform WidgetTransform = GetManipulatorTransformWithOffsets(ManipulatorComponent);
-				switch (ManipulatorComponent->Settings.Property.Type)
+				if (GetManipulatorPropertyHandler(ManipulatorComponent->Settings.Property.Type).bUsesWidget)
 				{
-				case EManipulatorPropertyType::MT_TRANSFORM:
-					InMatrix = FRotationMatrix::Make((WidgetTransform).GetRotation());
-					return true;
-					break;
-				case EManipulatorPropertyType::MT_VECTOR:
+					FTransform WidgetTransform = GetManipulatorTransformWithOffsets(Manipulator, SelectedManipulators.Last()->PropertyIndex);
 					InMatrix = FRotationMatrix::Make(WidgetTransform.GetRotation());
 					return true;
-					break;
-				case EManipulatorPropertyType::MT_ENUM:
-					InMatrix = FRotationMatrix::Make(WidgetTransform.GetRotation());
-					return true;
-					break;
 				}
 			}
 		}
@@ -464,16 +958,26 @@ bool FManipulatorToolsEditorEdMode::GetCustomDrawingCoordinateSystem(FMatrix& In
 
 void FManipulatorToolsEditorEdMode::ActorSelectionChangeNotify()
 {
+	// Declared manipulators are only remembered while their actor is selected.
+	FManipulatorDescriptors::Prune();
+	InvalidateManipulatorFrame();
+	RecordActorSelection();
 }
 
 bool FManipulatorToolsEditorEdMode::UsesToolkits() const
 {
-	return true;
+	// Replaying input from a commandlet has no UI to put the toolkit in.
+	return IsRunningCommandlet() == false;
 }
 
 void FManipulatorToolsEditorEdMode::Tick(FEditorViewportClient * ViewportClient, float DeltaTime)
 {
 	FEdMode::Tick(ViewportClient, DeltaTime);
+	FlushPendingKeys();
+
+	//Handle Forced Selections and removals, then tell listeners about what changed last frame outside of rendering.
+	HandleSelectionRequests();
+	UManipulatorComponent::BroadcastSelectionChanges();
 }
 
 bool FManipulatorToolsEditorEdMode::Select(AActor * InActor, bool bInSelected)
@@ -487,6 +991,7 @@ void FManipulatorToolsEditorEdMode::SetSequencer(TWeakPtr<ISequencer> InSequence
 {
 	WeakSequencer = InSequencer;
 	AllowTrackSelectionUpdate = true;
+	SelectedManipulatorTracks.Reset();
 	if (UsesToolkits())
 	{
 		// TODO: Reference ControlRigEditMode for this. Getting this setup may be a more correct way of doing auto key.
@@ -496,12 +1001,18 @@ void FManipulatorToolsEditorEdMode::SetSequencer(TWeakPtr<ISequencer> InSequence
 
 void FManipulatorToolsEditorEdMode::OnSequencerTrackSelectionChanged(TArray<UMovieSceneTrack*> InTracks)
 {
+	// The sequencer may report the selection the mode just pushed, right away or a tick later, it's not a new selection.
+	if (bUpdatingSequencerSelection || IsSequencerSelectionEcho(InTracks))
+	{
+		return;
+	}
+
 	if (WeakSequencer != nullptr)
 	{
 		TSharedPtr<ISequencer> Sequencer = WeakSequencer.Pin();
 		UMovieSceneSequence* SequenceScene = Sequencer->GetFocusedMovieSceneSequence();
 		UMovieScene* Scene = SequenceScene->GetMovieScene();
-		auto Bindings = Scene->GetBindings();
+		const TArray<FMovieSceneBinding>& Bindings = Scene->GetBindings();
 
 		bool ClearSelection = true;
 
@@ -517,18 +1028,25 @@ void FManipulatorToolsEditorEdMode::OnSequencerTrackSelectionChanged(TArray<UMov
 				FGuid MatchingGuid;
 				if (Scene->FindTrackBinding(*Track, MatchingGuid))
 				{
-					for (auto Binding : Bindings)
+					for (const FMovieSceneBinding& Binding : Bindings)
 					{
 						if (Binding.GetObjectGuid() == MatchingGuid)
 						{
 							if (ClearSelection)
 							{
 								ClearManipulatorSelection();
+								SelectedManipulatorTracks.Reset();
 								ClearSelection = false;
 							}
 							ActorSequencerName = Binding.GetName();
+
+							// The sequencer already has this track selected, remember it so the next push doesn't select it again.
+							const int32 NumSelected = NewSelectedManipulators.Num();
 							FindAndAddNewManipulatorSelection(PropertyName, ActorSequencerName);
-							continue;
+							if (NewSelectedManipulators.Num() > NumSelected)
+							{
+								SelectedManipulatorTracks.Add(FManipulatorSelectionKey(*NewSelectedManipulators.Last()), Track);
+							}
 						}
 					}
 				}
@@ -566,6 +1084,21 @@ void FManipulatorToolsEditorEdMode::ReduceDeSelectCounter()
 
 void FManipulatorToolsEditorEdMode::SequencerKeyProperty(UObject* ObjectToKey, UProperty* propertyToUse)
 {
+	// Mouse moves come in faster than frames so drags only remember what to key, it gets keyed once at the end of the frame.
+	if (DragTransaction.IsValid())
+	{
+		FPendingManipulatorKey PendingKey;
+		PendingKey.Object = ObjectToKey;
+		PendingKey.Property = propertyToUse;
+		PendingKeys.AddUnique(PendingKey);
+		return;
+	}
+	SequencerKeyPropertyNow(ObjectToKey, propertyToUse);
+}
+
+void FManipulatorToolsEditorEdMode::SequencerKeyPropertyNow(UObject* ObjectToKey, UProperty* propertyToUse)
+{
+	FManipulatorLatencyScope LatencyScope(EManipulatorLatencyStat::SequencerKey);
 	if (WeakSequencer != nullptr)
 	{
 		TSharedPtr<ISequencer> Sequencer = WeakSequencer.Pin();
@@ -587,43 +1120,212 @@ void FManipulatorToolsEditorEdMode::SequencerKeyProperty(UObject* ObjectToKey, U
 	}
 }
 
+void FManipulatorToolsEditorEdMode::FlushPendingKeys()
+{
+	if (PendingKeys.Num() == 0)
+	{
+		return;
+	}
+
+	TSharedPtr<ISequencer> Sequencer = WeakSequencer.Pin();
+	if (Sequencer.IsValid() && Sequencer->GetAutoChangeMode() != EAutoChangeMode::None)
+	{
+		const FFrameNumber CurrentFrame = Sequencer->GetLocalTime().Time.RoundToFrame();
+		for (const FPendingManipulatorKey& PendingKey : PendingKeys)
+		{
+			UObject* ObjectToKey = PendingKey.Object.Get();
+			if (ObjectToKey == nullptr)
+			{
+				continue;
+			}
+			if (bReduceKeysOnRelease == false)
+			{
+				SequencerKeyPropertyNow(ObjectToKey, PendingKey.Property);
+				continue;
+			}
+
+			// Only keys the drag adds can be reduced away, a key that was already on this frame belongs to the user and only gets its value updated.
+			FDragKeyedProperty* KeyedProperty = DragKeyedProperties.FindByPredicate([&PendingKey](const FDragKeyedProperty& Keyed) { return Keyed.Key == PendingKey; });
+			if (KeyedProperty == nullptr)
+			{
+				KeyedProperty = &DragKeyedProperties[DragKeyedProperties.AddDefaulted()];
+				KeyedProperty->Key = PendingKey;
+			}
+			const bool bHadKey = KeyedProperty->CreatedFrames.Contains(CurrentFrame) || HasFloatKeyAt(*Sequencer, ObjectToKey, PendingKey.Property, CurrentFrame);
+			SequencerKeyPropertyNow(ObjectToKey, PendingKey.Property);
+			if (bHadKey == false)
+			{
+				KeyedProperty->CreatedFrames.Add(CurrentFrame);
+			}
+		}
+	}
+	PendingKeys.Reset();
+}
+
+void FManipulatorToolsEditorEdMode::ReduceDragKeys()
+{
+	TSharedPtr<ISequencer> Sequencer = WeakSequencer.Pin();
+	if (Sequencer.IsValid() == false || DragKeyedProperties.Num() == 0)
+	{
+		return;
+	}
+
+	bool bAnyReduced = false;
+	TArray<TPair<UMovieSceneSection*, FMovieSceneFloatChannel*>> Channels;
+	for (const FDragKeyedProperty& KeyedProperty : DragKeyedProperties)
+	{
+		UObject* KeyedObject = KeyedProperty.Key.Object.Get();
+		if (KeyedObject == nullptr || KeyedProperty.CreatedFrames.Num() == 0)
+		{
+			continue;
+		}
+
+		GetKeyedFloatChannels(*Sequencer, KeyedObject, KeyedProperty.Key.Property, Channels);
+		for (const TPair<UMovieSceneSection*, FMovieSceneFloatChannel*>& Channel : Channels)
+		{
+			bAnyReduced |= ReduceCreatedKeys(Channel.Key, Channel.Value, KeyedProperty.CreatedFrames, KeyReductionTolerance);
+		}
+	}
+
+	if (bAnyReduced)
+	{
+		Sequencer->NotifyMovieSceneDataChanged(EMovieSceneDataChangeType::TrackValueChanged);
+	}
+}
+
 void FManipulatorToolsEditorEdMode::SequencerUpdateTrackSelection()
 {
 	// Handle updating the selected track when selecting a manipulator.
-	if (WeakSequencer != nullptr && AllowTrackSelectionUpdate)
+	TSharedPtr<ISequencer> Sequencer = WeakSequencer.Pin();
+	if (Sequencer.IsValid() == false || AllowTrackSelectionUpdate == false || Sequencer->GetFocusedMovieSceneSequence() == nullptr)
 	{
-		AllowTrackSelectionUpdate = false;
-		WeakSequencer.Pin()->EmptySelection();
-		for (FManipulatorData* ManipulatorData : SelectedManipulators)
+		return;
+	}
+	AllowTrackSelectionUpdate = false;
+	UMovieScene* Scene = Sequencer->GetFocusedMovieSceneSequence()->GetMovieScene();
+
+	// Manipulators that stay selected keep their cached track, bindings are only gathered once something needs looking up.
+	TMultiMap<FString, FGuid> BindingGuids;
+	TMap<FManipulatorSelectionKey, TWeakObjectPtr<UMovieSceneTrack>> NewTracks;
+	for (const FManipulatorData* ManipulatorData : SelectedManipulators)
+	{
+		const FManipulatorSelectionKey Key(*ManipulatorData);
+		const TWeakObjectPtr<UMovieSceneTrack>* CachedTrack = SelectedManipulatorTracks.Find(Key);
+		UMovieSceneTrack* Track = CachedTrack ? CachedTrack->Get() : nullptr;
+		if (Track == nullptr || Track->GetTypedOuter<UMovieScene>() != Scene)
 		{
-			TSharedPtr<ISequencer> Sequencer = WeakSequencer.Pin();
-			UMovieSceneSequence* SequenceScene = Sequencer->GetFocusedMovieSceneSequence();
-			UMovieScene* Scene = SequenceScene->GetMovieScene();
-			auto Bindings = Scene->GetBindings();
-			for (auto Binding : Bindings)
+			if (BindingGuids.Num() == 0)
 			{
-
-				if (ManipulatorData->ActorSequencerName == Binding.GetName())
+				for (const FMovieSceneBinding& Binding : Scene->GetBindings())
 				{
-					TArray<TSubclassOf<UMovieSceneTrack>> TrackClasses;
-					TrackClasses.Add(UMovieSceneBoolTrack::StaticClass());
-					TrackClasses.Add(UMovieSceneVectorTrack::StaticClass());
-					TrackClasses.Add(UMovieSceneTransformTrack::StaticClass());
-					TrackClasses.Add(UMovieSceneByteTrack::StaticClass());
-
-					for (TSubclassOf<UMovieSceneTrack> TrackClass : TrackClasses)
-					{
-						UMovieSceneTrack* Track = Scene->FindTrack(TrackClass, Binding.GetObjectGuid(), FName(*ManipulatorData->PropertyName));
-						if (IsValid(Track))
-						{
-							WeakSequencer.Pin()->SelectTrack(Track);
-							continue;
-						}
-					}
+					BindingGuids.Add(Binding.GetName(), Binding.GetObjectGuid());
 				}
 			}
+			Track = FindManipulatorTrack(Scene, BindingGuids, ManipulatorData);
+		}
+		if (Track != nullptr)
+		{
+			NewTracks.Add(Key, Track);
 		}
 	}
+
+	TSet<UMovieSceneTrack*> NewTrackSet;
+	for (const auto& Pair : NewTracks)
+	{
+		NewTrackSet.Add(Pair.Value.Get());
+	}
+	SelectedManipulatorTracks = MoveTemp(NewTracks);
+
+	// Compared with what the sequencer has selected rather than what was last pushed, so tracks the user picked in the sequencer are cleared as well.
+	TArray<UMovieSceneTrack*> SequencerTracks;
+	Sequencer->GetSelectedTracks(SequencerTracks);
+	const TSet<UMovieSceneTrack*> SequencerTrackSet(SequencerTracks);
+	if (SequencerTrackSet.Num() == NewTrackSet.Num() && SequencerTrackSet.Includes(NewTrackSet))
+	{
+		return;
+	}
+
+	// The sequencer can only add to its selection, so any difference rebuilds it.
+	TGuardValue<bool> UpdatingSelectionGuard(bUpdatingSequencerSelection, true);
+	Sequencer->EmptySelection();
+	for (UMovieSceneTrack* Track : NewTrackSet)
+	{
+		Sequencer->SelectTrack(Track);
+	}
+}
+
+UMovieSceneTrack* FManipulatorToolsEditorEdMode::FindManipulatorTrack(UMovieScene* Scene, const TMultiMap<FString, FGuid>& BindingGuids, const FManipulatorData* ManipulatorData) const
+{
+	// The property type's handler knows which track keys it.
+	const TSubclassOf<UMovieSceneTrack> TrackClass = GetManipulatorPropertyHandler(ManipulatorData->PropertyType).GetTrackClass();
+	TArray<FGuid> ObjectGuids;
+	BindingGuids.MultiFind(ManipulatorData->ActorSequencerName, ObjectGuids);
+	for (const FGuid& ObjectGuid : ObjectGuids)
+	{
+		UMovieSceneTrack* Track = Scene->FindTrack(TrackClass, ObjectGuid, FName(*ManipulatorData->PropertyName));
+		if (IsValid(Track))
+		{
+			return Track;
+		}
+	}
+	return nullptr;
+}
+
+bool FManipulatorToolsEditorEdMode::IsSequencerSelectionEcho(const TArray<UMovieSceneTrack*>& InTracks) const
+{
+	TSet<UMovieSceneTrack*> PushedTracks;
+	for (const auto& Pair : SelectedManipulatorTracks)
+	{
+		if (UMovieSceneTrack* Track = Pair.Value.Get())
+		{
+			PushedTracks.Add(Track);
+		}
+	}
+	return PushedTracks.Num() == InTracks.Num() && PushedTracks.Includes(TSet<UMovieSceneTrack*>(InTracks));
+}
+
+void FManipulatorToolsEditorEdMode::BakeSelectedManipulatorsToSequencer()
+{
+	TSharedPtr<ISequencer> Sequencer = WeakSequencer.Pin();
+	if (!Sequencer.IsValid() || Sequencer->GetFocusedMovieSceneSequence() == nullptr)
+	{
+		return;
+	}
+
+	TRange<FFrameNumber> BakeRange = Sequencer->GetSelectionRange();
+	if (BakeRange.IsEmpty())
+	{
+		BakeRange = Sequencer->GetFocusedMovieSceneSequence()->GetMovieScene()->GetPlaybackRange();
+	}
+
+	TArray<AActor*> SelectedActors;
+	GEditor->GetSelectedActors()->GetSelectedObjects(SelectedActors);
+	FManipulatorSequencerBake::Bake(Sequencer.ToSharedRef(), SelectedActors, BakeRange);
+}
+
+bool FManipulatorToolsEditorEdMode::CanBakeToSequencer() const
+{
+	return WeakSequencer.IsValid();
+}
+
+void FManipulatorToolsEditorEdMode::UpdateReduceKeysOnRelease(bool bNewReduceKeysOnRelease)
+{
+	bReduceKeysOnRelease = bNewReduceKeysOnRelease;
+}
+
+bool FManipulatorToolsEditorEdMode::GetReduceKeysOnRelease() const
+{
+	return bReduceKeysOnRelease;
+}
+
+void FManipulatorToolsEditorEdMode::UpdateKeyReductionTolerance(float NewKeyReductionTolerance)
+{
+	KeyReductionTolerance = FMath::Max(NewKeyReductionTolerance, 0.0f);
+}
+
+float FManipulatorToolsEditorEdMode::GetKeyReductionTolerance() const
+{
+	return KeyReductionTolerance;
 }
 
 /* ---------- Public Actor Selection ----------*/
@@ -649,106 +1351,155 @@ bool FManipulatorToolsEditorEdMode::GetUseSafeDeSelect() const
 	return bUseSafeDeSelect;
 }
 
-/* ---------- Private Manipulator Components ----------*/
+void FManipulatorToolsEditorEdMode::UpdateUseMirrorEditing(bool bNewUseMirrorEditing)
+{
+	bUseMirrorEditing = bNewUseMirrorEditing;
+	MirrorPartners.Reset();
+}
+
+bool FManipulatorToolsEditorEdMode::GetUseMirrorEditing() const
+{
+	return bUseMirrorEditing;
+}
+
+void FManipulatorToolsEditorEdMode::CopyManipulatorPose()
+{
+	TArray<AActor*> SelectedActors;
+	GEditor->GetSelectedActors()->GetSelectedObjects(SelectedActors);
+	CopiedPose = FManipulatorPoseSnapshot::Capture(SelectedActors);
+}
+
+void FManipulatorToolsEditorEdMode::PasteManipulatorPose()
+{
+	TArray<AActor*> SelectedActors;
+	GEditor->GetSelectedActors()->GetSelectedObjects(SelectedActors);
+	CopiedPose.Apply(SelectedActors);
+}
+
+bool FManipulatorToolsEditorEdMode::HasCopiedManipulatorPose() const
+{
+	return !CopiedPose.IsEmpty();
+}
+
+void FManipulatorToolsEditorEdMode::ApplyLibraryPose(UManipulatorPoseLibrary* PoseLibrary, int32 PoseIndex)
+{
+	TArray<uint8> PoseData;
+	if (IsValid(PoseLibrary) && PoseLibrary->LoadPoseData(PoseIndex, PoseData))
+	{
+		TArray<AActor*> SelectedActors;
+		GEditor->GetSelectedActors()->GetSelectedObjects(SelectedActors);
+		FManipulatorPoseSnapshot::FromData(MoveTemp(PoseData)).Apply(SelectedActors);
+	}
+}
 
-bool FManipulatorToolsEditorEdMode::GetSelectedManipulatorComponent(FManipulatorData* ManipulatorData, UManipulatorComponent*& OutComponent) const
+void FManipulatorToolsEditorEdMode::SaveLibraryPose(UManipulatorPoseLibrary* PoseLibrary, FName PoseName)
 {
-	// Finds the first actor then walks through the components to find the currently selected component based off of component name and property to edit. 
-	// Outputs false if at any point any of the out information is null or fails.
-	// TODO: Update for Multi-select
+	if (!IsValid(PoseLibrary) || PoseName.IsNone())
+	{
+		return;
+	}
+
 	TArray<AActor*> SelectedActors;
 	GEditor->GetSelectedActors()->GetSelectedObjects(SelectedActors);
+	SelectedActors.RemoveAll([](AActor* Actor) { return IsValid(Actor) == false; });
+	if (SelectedActors.Num() == 0)
+	{
+		return;
+	}
+
+	// The pose is tagged with the class it was taken from, which a selection spanning several classes doesn't have.
+	UClass* PoseClass = SelectedActors[0]->GetClass();
 	for (AActor* SelectedActor : SelectedActors)
 	{
-		if (IsValid(SelectedActor))
+		if (SelectedActor->GetClass() != PoseClass)
 		{
-			TArray<UActorComponent*> Manipulators = SelectedActor->GetComponentsByClass(UManipulatorComponent::StaticClass());
-			for (UActorComponent* ActorComponent : Manipulators)
+			FNotificationInfo Info(LOCTEXT("SaveManipulatorPoseMixedClasses", "Pose not saved, the selected actors are of different classes. Select actors of a single class to save a pose."));
+			Info.ExpireDuration = 5.0f;
+			TSharedPtr<SNotificationItem> Notification = FSlateNotificationManager::Get().AddNotification(Info);
+			if (Notification.IsValid())
 			{
-				UManipulatorComponent* ManipulatorComponent = Cast<UManipulatorComponent>(ActorComponent);
-				if (IsValid(ManipulatorComponent))
-				{
-					if (ManipulatorComponent->GetManipulatorID() == ManipulatorData->ID)
-					{
-						OutComponent = ManipulatorComponent;
-						return true;
-					}
-				}
+				Notification->SetCompletionState(SNotificationItem::CS_Fail);
 			}
+			return;
 		}
 	}
-	return false;
+
+	const FManipulatorPoseSnapshot Snapshot = FManipulatorPoseSnapshot::Capture(SelectedActors);
+	if (Snapshot.IsEmpty())
+	{
+		return;
+	}
+
+	const FScopedTransaction Transaction(LOCTEXT("SaveManipulatorPose", "Save Manipulator Pose"));
+	PoseLibrary->Modify();
+	PoseLibrary->SetPoseData(PoseName, PoseClass, Snapshot.GetData(), Snapshot.Num());
+}
+
+/* ---------- Private Manipulator Components ----------*/
+
+bool FManipulatorToolsEditorEdMode::GetSelectedManipulator(FManipulatorData* ManipulatorData, FManipulatorHandle& OutManipulator) const
+{
+	// Looked up by id so a manipulator recreated by the construction script or a recompile is found again without walking the selected actors.
+	FManipulatorHandle Manipulator;
+	if (FManipulatorDescriptors::FindManipulator(ManipulatorData->ManipulatorGuid, Manipulator) == false || Manipulator.IsValid() == false)
+	{
+		return false;
+	}
+
+	if (Manipulator.GetActor()->IsSelected() == false)
+	{
+		return false;
+	}
+
+	const UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
+
+	// The id only covers the manipulator, the property it points at can still have been changed since it was selected.
+	const FManipulatorSettingsMainProperty& Property = ManipulatorComponent->Settings.Property;
+	if (Property.NameToEdit != ManipulatorData->PropertyName || (ManipulatorComponent->DrivesAllArrayElements() == false && Property.Index != ManipulatorData->PropertyIndex))
+	{
+		return false;
+	}
+
+	OutManipulator = Manipulator;
+	return true;
 }
-FTransform FManipulatorToolsEditorEdMode::GetManipulatorTransformWithOffsets(UManipulatorComponent* ManipulatorComponent) const
+
+FTransform FManipulatorToolsEditorEdMode::GetManipulatorTransformWithOffsets(const FManipulatorHandle& Manipulator, int32 PropertyIndex) const
 {
 	FTransform FakeTransform = FTransform::Identity;
-	return GetManipulatorTransformWithOffsets(ManipulatorComponent, FakeTransform);
+	return GetManipulatorTransformWithOffsets(Manipulator, PropertyIndex, FakeTransform);
 }
 
-FTransform FManipulatorToolsEditorEdMode::GetManipulatorTransformWithOffsets(UManipulatorComponent * ManipulatorComponent, FTransform& WidgetTransformNoPropertyOffset) const
+FTransform FManipulatorToolsEditorEdMode::GetManipulatorTransformWithOffsets(const FManipulatorHandle& Manipulator, int32 PropertyIndex, FTransform& WidgetTransformNoPropertyOffset, const FTransform* AttachedSocketTransform) const
 {
-	if (IsValid(ManipulatorComponent) == false || IsValid(ManipulatorComponent->GetAttachmentRootActor()) == false)
+	if (Manipulator.IsValid() == false)
 	{
 		return FTransform::Identity;
 	}
+	UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
 	// Enum Offsets
 	FVector EnumPropertyOffset = FVector(0, 0, 0);
-	uint8 EnumValue = 0;
 
 	// Visual Offset and Relative Offset
 	FTransform PropertyTransform = FTransform::Identity;
 	FTransform WidgetTransform = FTransform::Identity;
-	UObject* ObjectToEditProperties = GetObjectToDisplayWidgetsFromManipulator(ManipulatorComponent);
-
-	// Handle offsets per property type bools are ignored in here because they are essentially world buttons.
-	switch (ManipulatorComponent->Settings.Property.Type)
-	{
-	case EManipulatorPropertyType::MT_ENUM:
-		if (IsValid(ObjectToEditProperties))
-		{
-			EnumValue = GetPropertyValueByName<uint8>(ObjectToEditProperties, ManipulatorComponent->Settings.Property.NameToEdit, ManipulatorComponent->Settings.Property.Index);
+	UObject* ObjectToEditProperties = GetObjectToDisplayWidgetsFromManipulator(Manipulator);
 
-			//Use the direction vector * Step to calulate the offset position of the current enum.
-			FManipulatorSettingsMainPropertyTypeEnum Settings = ManipulatorComponent->Settings.Property.EnumSettings;
-
-			switch (ManipulatorComponent->Settings.Property.EnumSettings.Direction)
-			{
-			case EManipulatorPropertyEnumDirection::MT_X:
-				EnumPropertyOffset.X = Settings.StepSize * EnumValue;
-				break;
-			case EManipulatorPropertyEnumDirection::MT_Y:
-				EnumPropertyOffset.Y = Settings.StepSize * EnumValue;
-				break;
-			case EManipulatorPropertyEnumDirection::MT_Z:
-				EnumPropertyOffset.Z = Settings.StepSize * EnumValue;
-				break;
-			}
-		}
-		break;
-	case EManipulatorPropertyType::MT_TRANSFORM:
-	{
-		PropertyTransform = GetPropertyValueByName<FTransform>(ObjectToEditProperties, ManipulatorComponent->Settings.Property.NameToEdit, ManipulatorComponent->Settings.Property.Index);
-		break;
-	}
-	case EManipulatorPropertyType::MT_VECTOR:
-	{
-		PropertyTransform = FTransform(GetPropertyValueByName<FVector>(ObjectToEditProperties, ManipulatorComponent->Settings.Property.NameToEdit, ManipulatorComponent->Settings.Property.Index));
-		break;
-	}
-	}
+	// The property type's handler turns the value into a relative transform, enums step the widget with an offset instead and bools are ignored because they are essentially world buttons.
+	GetManipulatorPropertyHandler(ManipulatorComponent->Settings.Property.Type).Read(ObjectToEditProperties, ManipulatorComponent->Settings.Property, PropertyIndex, PropertyTransform, EnumPropertyOffset);
 
 	// Constrain the relative transform via the manipulator components settings.
 	PropertyTransform = ManipulatorComponent->ConstrainTransform(PropertyTransform);
-	PropertyTransform = FlipTransformOnX(PropertyTransform, ManipulatorComponent->Settings.Draw.Extras.FlipVisualXLocation, ManipulatorComponent->Settings.Draw.Extras.FlipVisualYRotation, ManipulatorComponent->Settings.Draw.Extras.FlipVisualXScale);
+	PropertyTransform = FlipTransformOnX(PropertyTransform, ManipulatorComponent->GetDrawSettings().Extras.FlipVisualXLocation, ManipulatorComponent->GetDrawSettings().Extras.FlipVisualYRotation, ManipulatorComponent->GetDrawSettings().Extras.FlipVisualXScale);
 
 	FTransform SocketTransform = FTransform::Identity;
 
-	if (ManipulatorComponent->Settings.Draw.Extras.UseAttachedSocketAsInitialOffset == true)
+	if (ManipulatorComponent->GetDrawSettings().Extras.UseAttachedSocketAsInitialOffset == true)
 	{
-		SocketTransform = ManipulatorComponent->GetSocketTransform(ManipulatorComponent->GetAttachSocketName(), ERelativeTransformSpace::RTS_Actor);
+		SocketTransform = AttachedSocketTransform ? *AttachedSocketTransform : ManipulatorComponent->GetSocketTransform(ManipulatorComponent->GetAttachSocketName(), ERelativeTransformSpace::RTS_Actor);
 		SocketTransform = PropertyTransform.Inverse() * SocketTransform;
 	}
-	else if (ManipulatorComponent->Settings.Draw.Extras.UsePropertyValueAsInitialOffset == false)
+	else if (ManipulatorComponent->GetDrawSettings().Extras.UsePropertyValueAsInitialOffset == false)
 	{
 		PropertyTransform = FTransform::Identity;
 	}
@@ -759,25 +1510,86 @@ FTransform FManipulatorToolsEditorEdMode::GetManipulatorTransformWithOffsets(UMa
 	EnumPropertyTransform.NormalizeRotation();
 
 	// Compose Relative Transform, Enum Offset, Visual Offset and Actor Transform together to get the final Widget Transform.
-	WidgetTransform = PropertyTransform * EnumPropertyTransform * ManipulatorComponent->CombineOffsetTransforms(ManipulatorComponent->Settings.Draw.Offsets) * SocketTransform *  ManipulatorComponent->GetOwner()->GetActorTransform();
+	WidgetTransform = PropertyTransform * EnumPropertyTransform * ManipulatorComponent->CombineOffsetTransforms(ManipulatorComponent->GetDrawSettings().Offsets) * SocketTransform *  Manipulator.GetActor()->GetActorTransform();
 	WidgetTransform.NormalizeRotation();
-	WidgetTransformNoPropertyOffset = EnumPropertyTransform * ManipulatorComponent->CombineOffsetTransforms(ManipulatorComponent->Settings.Draw.Offsets) * SocketTransform * ManipulatorComponent->GetOwner()->GetActorTransform();
+	WidgetTransformNoPropertyOffset = EnumPropertyTransform * ManipulatorComponent->CombineOffsetTransforms(ManipulatorComponent->GetDrawSettings().Offsets) * SocketTransform * Manipulator.GetActor()->GetActorTransform();
 	WidgetTransformNoPropertyOffset.NormalizeRotation();
 	return WidgetTransform;
 }
 
+void FManipulatorToolsEditorEdMode::GetManipulatorElementTransforms(const FManipulatorHandle& Manipulator, TArray<FTransform>& OutWidgetTransforms, const FTransform* AttachedSocketTransform) const
+{
+	OutWidgetTransforms.Reset();
+	if (Manipulator.IsValid() == false)
+	{
+		return;
+	}
+
+	UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
+	UObject* ObjectToEditProperties = GetObjectToDisplayWidgetsFromManipulator(Manipulator);
+	const FManipulatorSettingsMain& Settings = ManipulatorComponent->Settings;
+	const FManipulatorSettingsMainDraw& DrawSettings = ManipulatorComponent->GetDrawSettings();
+
+	// Read the whole array with a single reflection walk.
+	if (Settings.Property.Type == EManipulatorPropertyType::MT_TRANSFORM)
+	{
+		GetPropertyArrayValuesByName<FTransform>(ObjectToEditProperties, Settings.Property.NameToEdit, OutWidgetTransforms);
+	}
+	else
+	{
+		TArray<FVector> Locations;
+		GetPropertyArrayValuesByName<FVector>(ObjectToEditProperties, Settings.Property.NameToEdit, Locations);
+		OutWidgetTransforms.Reserve(Locations.Num());
+		for (const FVector& Location : Locations)
+		{
+			OutWidgetTransforms.Add(FTransform(Location));
+		}
+	}
+
+	ManipulatorComponent->ConstrainTransformsInPlace(OutWidgetTransforms);
+
+	// Everything to the right of the property transform is shared between elements so only work it out once.
+	const FTransform OffsetTransform = ManipulatorComponent->CombineOffsetTransforms(DrawSettings.Offsets);
+	const FTransform ActorTransform = Manipulator.GetActor()->GetActorTransform();
+	FTransform SocketTransform = FTransform::Identity;
+	if (DrawSettings.Extras.UseAttachedSocketAsInitialOffset == true)
+	{
+		SocketTransform = AttachedSocketTransform ? *AttachedSocketTransform : ManipulatorComponent->GetSocketTransform(ManipulatorComponent->GetAttachSocketName(), ERelativeTransformSpace::RTS_Actor);
+	}
+
+	for (FTransform& ElementTransform : OutWidgetTransforms)
+	{
+		FTransform PropertyTransform = FlipTransformOnX(ElementTransform, DrawSettings.Extras.FlipVisualXLocation, DrawSettings.Extras.FlipVisualYRotation, DrawSettings.Extras.FlipVisualXScale);
+		FTransform ElementSocketTransform = FTransform::Identity;
+		if (DrawSettings.Extras.UseAttachedSocketAsInitialOffset == true)
+		{
+			ElementSocketTransform = PropertyTransform.Inverse() * SocketTransform;
+		}
+		else if (DrawSettings.Extras.UsePropertyValueAsInitialOffset == false)
+		{
+			PropertyTransform = FTransform::Identity;
+		}
+		PropertyTransform.NormalizeRotation();
+		ElementSocketTransform.NormalizeRotation();
+
+		ElementTransform = PropertyTransform * OffsetTransform * ElementSocketTransform * ActorTransform;
+		ElementTransform.NormalizeRotation();
+	}
+}
+
 UManipulatorComponent * FManipulatorToolsEditorEdMode::FindManipulatorComponentInActor(FString PropertyName, FString ActorName)
 {
 	return nullptr;
 }
 
-bool FManipulatorToolsEditorEdMode::GetBoolPropertyValueFromManipulator(UManipulatorComponent* ManipulatorComponent)
+bool FManipulatorToolsEditorEdMode::GetBoolPropertyValueFromManipulator(const FManipulatorHandle& Manipulator)
 {
 	// Used to tell bools when to change color.
 	bool Output = false;
+	const UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
 	if (ManipulatorComponent->Settings.Property.Type == EManipulatorPropertyType::MT_BOOL)
 	{
-		UObject* ObjectToEditProperties = GetObjectToDisplayWidgetsFromManipulator(ManipulatorComponent);
+		UObject* ObjectToEditProperties = GetObjectToDisplayWidgetsFromManipulator(Manipulator);
 		if (IsValid(ObjectToEditProperties))
 		{
 			Output = GetPropertyValueByName<bool>(ObjectToEditProperties, ManipulatorComponent->Settings.Property.NameToEdit, ManipulatorComponent->Settings.Property.Index);
@@ -786,80 +1598,279 @@ bool FManipulatorToolsEditorEdMode::GetBoolPropertyValueFromManipulator(UManipul
 	return Output;
 }
 
-void FManipulatorToolsEditorEdMode::ToggleBoolPropertyValueFromManipulator(UManipulatorComponent* ManipulatorComponent)
+void FManipulatorToolsEditorEdMode::ToggleBoolPropertyValueFromManipulator(const FManipulatorHandle& Manipulator)
 {
 	// Toggles a bool on and off when clicked. 
+	const UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
 	if (ManipulatorComponent->Settings.Property.Type == EManipulatorPropertyType::MT_BOOL)
 	{
 		bool CurrentBool = false;
-		UObject* ObjectToEditProperties = GetObjectToDisplayWidgetsFromManipulator(ManipulatorComponent);
+		UObject* ObjectToEditProperties = GetObjectToDisplayWidgetsFromManipulator(Manipulator);
 		if (IsValid(ObjectToEditProperties))
 		{
 			CurrentBool = GetPropertyValueByName<bool>(ObjectToEditProperties, ManipulatorComponent->Settings.Property.NameToEdit, ManipulatorComponent->Settings.Property.Index);
 
 			// Set Bool Value
-			ObjectToEditProperties->PreEditChange(NULL);
+			FEditPropertyChain PropertyChain;
 			UProperty* SetProperty = NULL;
-			SetPropertyValueByName<bool>(ObjectToEditProperties, ManipulatorComponent->Settings.Property.NameToEdit, ManipulatorComponent->Settings.Property.Index, !CurrentBool, SetProperty);
+			if (bool* ValuePtr = (bool*)BeginManipulatorPropertyEdit(GetManipulatorPropertyHandler(EManipulatorPropertyType::MT_BOOL), ObjectToEditProperties, ManipulatorComponent->Settings.Property.NameToEdit, ManipulatorComponent->Settings.Property.Index, SetProperty, &PropertyChain))
+			{
+				*ValuePtr = !CurrentBool;
+				SequencerKeyProperty(ObjectToEditProperties, SetProperty);
+				PostEditManipulatorProperty(ObjectToEditProperties, PropertyChain);
+			}
+		}
+	}
+}
+
+void* FManipulatorToolsEditorEdMode::BeginManipulatorPropertyEdit(const FManipulatorPropertyHandler& PropertyHandler, UObject* Object, const FString& PropertyName, int32 PropertyIndex, UProperty*& OutProperty, FEditPropertyChain* OutPropertyChain)
+{
+	OutProperty = NULL;
+	void* ValuePtr = PropertyHandler.Resolve(Object, PropertyName, PropertyIndex, OutProperty, OutPropertyChain);
+	if (ValuePtr == NULL || OutProperty == NULL)
+	{
+		OutProperty = NULL;
+		return NULL;
+	}
+
+	// Without a chain the caller has already sent a PreEditChange that covers this write.
+	if (OutPropertyChain != NULL)
+	{
+		// Head of the chain is the member on the object, tail is the value actually being written.
+		OutPropertyChain->SetActiveMemberPropertyNode(OutPropertyChain->GetHead()->GetValue());
+		OutPropertyChain->SetActivePropertyNode(OutPropertyChain->GetTail()->GetValue());
+		Object->PreEditChange(*OutPropertyChain);
+	}
+	return ValuePtr;
+}
+
+void FManipulatorToolsEditorEdMode::PostEditManipulatorProperty(UObject* Object, FEditPropertyChain& PropertyChain, EPropertyChangeType::Type ChangeType)
+{
+	FManipulatorLatencyScope LatencyScope(EManipulatorLatencyStat::PostEditChange);
+	FPropertyChangedEvent PropertyChangeEvent(PropertyChain.GetActiveNode()->GetValue(), ChangeType);
+	PropertyChangeEvent.SetActiveMemberProperty(PropertyChain.GetActiveMemberNode()->GetValue());
+	FPropertyChangedChainEvent PropertyChangeChainEvent(PropertyChain, PropertyChangeEvent);
+	Object->PostEditChangeChainProperty(PropertyChangeChainEvent);
+}
+
+UProperty* FManipulatorToolsEditorEdMode::WriteManipulatorEdit(const FManipulatorEdit& Edit, FEditPropertyChain* PropertyChain)
+{
+	FManipulatorLatencyScope LatencyScope(EManipulatorLatencyStat::PropertyWrite);
+	const FManipulatorPropertyHandler& PropertyHandler = GetManipulatorPropertyHandler(Edit.Property.Type);
+	UProperty* SetProperty = NULL;
+	void* ValuePtr = BeginManipulatorPropertyEdit(PropertyHandler, Edit.Object, Edit.Property.NameToEdit, Edit.PropertyIndex, SetProperty, PropertyChain);
+	if (ValuePtr != NULL)
+	{
+		PropertyHandler.ApplyTransform(ValuePtr, Edit.Value, Edit.Property);
+	}
+	return SetProperty;
+}
+
+bool FManipulatorToolsEditorEdMode::ApplyManipulatorEdits(TArray<FManipulatorEdit>& Edits)
+{
+	// Group edits by the object they write to so each object only reruns its construction script once.
+	Edits.StableSort([](const FManipulatorEdit& A, const FManipulatorEdit& B)
+	{
+		return A.Object < B.Object;
+	});
+
+	bool bAnyWritten = false;
+	for (int32 GroupStart = 0; GroupStart < Edits.Num();)
+	{
+		UObject* Object = Edits[GroupStart].Object;
+		int32 GroupEnd = GroupStart + 1;
+		while (GroupEnd < Edits.Num() && Edits[GroupEnd].Object == Object)
+		{
+			GroupEnd++;
+		}
 
-			SequencerKeyProperty(ObjectToEditProperties, SetProperty);
+		if (GroupEnd - GroupStart == 1)
+		{
+			// A lone edit keeps its notification scoped to the property it changed.
+			FEditPropertyChain PropertyChain;
+			UProperty* SetProperty = WriteManipulatorEdit(Edits[GroupStart], &PropertyChain);
+			if (SetProperty != NULL)
+			{
+				SequencerKeyProperty(Object, SetProperty);
+				PostEditManipulatorProperty(Object, PropertyChain);
+				bAnyWritten = true;
+			}
+		}
+		else
+		{
+			// Every edit gets its own notification scoped to its property so listeners and the details panel know what changed.
+			TArray<TUniquePtr<FEditPropertyChain>> PropertyChains;
+			for (int32 EditIndex = GroupStart; EditIndex < GroupEnd; EditIndex++)
+			{
+				TUniquePtr<FEditPropertyChain> PropertyChain = MakeUnique<FEditPropertyChain>();
+				UProperty* SetProperty = WriteManipulatorEdit(Edits[EditIndex], PropertyChain.Get());
+				if (SetProperty != NULL)
+				{
+					SequencerKeyProperty(Object, SetProperty);
+					PropertyChains.Add(MoveTemp(PropertyChain));
+					bAnyWritten = true;
+				}
+			}
 
-			FPropertyChangedEvent PropertyChangeEvent(SetProperty);
-			ObjectToEditProperties->PostEditChangeProperty(PropertyChangeEvent);
+			// All but the last are interactive so only the final notification finishes the edit, actors that don't run their construction script on drag only rerun it once for the whole group.
+			for (int32 ChainIndex = 0; ChainIndex < PropertyChains.Num(); ChainIndex++)
+			{
+				const bool bLastEdit = ChainIndex == PropertyChains.Num() - 1;
+				PostEditManipulatorProperty(Object, *PropertyChains[ChainIndex], bLastEdit ? EPropertyChangeType::ValueSet : EPropertyChangeType::Interactive);
+			}
 		}
+
+		GroupStart = GroupEnd;
 	}
+	return bAnyWritten;
 }
 
-UObject * FManipulatorToolsEditorEdMode::GetObjectToDisplayWidgetsFromManipulator(/*FTransform & OutLocalToWorld, */ UManipulatorComponent* ManipulatorComponent) const
+bool FManipulatorToolsEditorEdMode::FindMirrorPartner(const FManipulatorHandle& Manipulator, FManipulatorHandle& OutPartner)
 {
-	// Determine what is selected, preferring a component over an actor
-	USceneComponent* SelectedComponent = ManipulatorComponent->GetOwner()->GetRootComponent();
-	UObject* BestSelectedItem = ManipulatorComponent->GetOwner();
-	//OutLocalToWorld = GetManipulatorTransformWithOffsets(ManipulatorComponent);
-	return BestSelectedItem; 
+	AActor* Actor = Manipulator.GetActor();
+	if (IsValid(Actor) == false)
+	{
+		return false;
+	}
+
+	TMap<FName, FName>* Pairs = MirrorPartners.Find(Actor);
+	if (Pairs == nullptr)
+	{
+		Pairs = &MirrorPartners.Add(Actor);
+		BuildMirrorPartners(Actor, *Pairs);
+	}
+
+	const FName* PartnerName = Pairs->Find(Manipulator.GetName());
+	if (PartnerName == nullptr)
+	{
+		return false;
+	}
+
+	TArray<FManipulatorHandle> Manipulators;
+	FManipulatorDescriptors::GetActorManipulators(Actor, Manipulators);
+	for (const FManipulatorHandle& Partner : Manipulators)
+	{
+		if (Partner.GetName() == *PartnerName)
+		{
+			OutPartner = Partner;
+			return true;
+		}
+	}
+	return false;
 }
 
-uint8 FManipulatorToolsEditorEdMode::HandleEnumPropertyInputDelta(UManipulatorComponent* ManipulatorComponent, FTransform LocalTM, uint8 EnumInput)
+void FManipulatorToolsEditorEdMode::BuildMirrorPartners(AActor* Actor, TMap<FName, FName>& OutPairs) const
 {
-	//Use the direction vector * Step to calulate the offset position of the current enum.
-	FManipulatorSettingsMainPropertyTypeEnum EnumSettings = ManipulatorComponent->Settings.Property.EnumSettings;
-	float AxisCheck = 0;
-	float EnumAsFloat = EnumInput;
-	switch (ManipulatorComponent->Settings.Property.EnumSettings.Direction)
+	TArray<FManipulatorHandle> Manipulators;
+	FManipulatorDescriptors::GetActorManipulators(Actor, Manipulators);
+	TSet<FName> ManipulatorNames;
+	for (const FManipulatorHandle& Manipulator : Manipulators)
 	{
-	case EManipulatorPropertyEnumDirection::MT_X:
-		AxisCheck = LocalTM.GetLocation().X;
-		break;
-	case EManipulatorPropertyEnumDirection::MT_Y:
-		AxisCheck = LocalTM.GetLocation().Y;
-		break;
-	case EManipulatorPropertyEnumDirection::MT_Z:
-		AxisCheck = LocalTM.GetLocation().Z;
-		break;
+		ManipulatorNames.Add(Manipulator.GetName());
+	}
+
+	// Explicit partners win over anything found by name so they are paired first.
+	for (int32 Pass = 0; Pass < 2; Pass++)
+	{
+		for (const FManipulatorHandle& Manipulator : Manipulators)
+		{
+			const FName ManipulatorName = Manipulator.GetName();
+			if (Manipulator.IsValid() == false || OutPairs.Contains(ManipulatorName))
+			{
+				continue;
+			}
+			const UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
+
+			FName PartnerName = NAME_None;
+			if (Pass == 0)
+			{
+				PartnerName = ManipulatorComponent->Settings.Property.MirrorPartner;
+			}
+			else
+			{
+				const FString MirroredName = GetMirroredManipulatorName(ManipulatorName.ToString());
+				PartnerName = MirroredName.IsEmpty() ? NAME_None : FName(*MirroredName);
+			}
+
+			if (PartnerName.IsNone() == false && PartnerName != ManipulatorName && ManipulatorNames.Contains(PartnerName) && OutPairs.Contains(PartnerName) == false)
+			{
+				OutPairs.Add(ManipulatorName, PartnerName);
+				OutPairs.Add(PartnerName, ManipulatorName);
+			}
+		}
+	}
+}
+
+void FManipulatorToolsEditorEdMode::QueueMirroredEdit(const FManipulatorHandle& Manipulator, int32 PropertyIndex, const FTransform& VisualTransform, const FTransform& VisualTransformWithDelta, TArray<FManipulatorEdit>& InOutEdits)
+{
+	FManipulatorHandle Partner;
+	if (FindMirrorPartner(Manipulator, Partner) == false || Partner.IsValid() == false)
+	{
+		return;
+	}
+	UManipulatorComponent* PartnerComponent = Partner.GetComponent();
+	if (PartnerComponent->Settings.Property.Type != Manipulator.GetComponent()->Settings.Property.Type)
+	{
+		return;
 	}
 
-	//add and clamp output.
-	EnumAsFloat = EnumAsFloat + (FMath::GridSnap(AxisCheck, EnumSettings.StepSize) / EnumSettings.StepSize);
-	if (EnumAsFloat > EnumSettings.EnumSize - 1)
+	// A selected partner is already getting the drag itself.
+	const int32 PartnerIndex = PartnerComponent->DrivesAllArrayElements() ? PropertyIndex : PartnerComponent->Settings.Property.Index;
+	if (IsManipulatorSelected(Partner, PartnerIndex))
 	{
-		EnumAsFloat = EnumSettings.EnumSize - 1;
+		return;
 	}
-	else if (EnumAsFloat < 0)
+
+	UObject* PartnerObject = GetObjectToDisplayWidgetsFromManipulator(Partner);
+	const FManipulatorSettingsMainProperty& PartnerProperty = PartnerComponent->Settings.Property;
+	const FManipulatorSettingsMainDrawExtras& PartnerExtras = PartnerComponent->GetDrawSettings().Extras;
+
+	FTransform PartnerTransform = FTransform::Identity;
+	FVector PartnerWidgetOffset = FVector::ZeroVector;
+	const FManipulatorPropertyHandler& PropertyHandler = GetManipulatorPropertyHandler(PartnerProperty.Type);
+	if (!PropertyHandler.bUsesWidget || !PropertyHandler.Read(PartnerObject, PartnerProperty, PartnerIndex, PartnerTransform, PartnerWidgetOffset))
 	{
-		EnumAsFloat = 0;
+		return;
 	}
-	return uint8(EnumAsFloat);
+	PartnerTransform = FlipTransformOnX(PartnerTransform, PartnerExtras.FlipVisualXLocation, PartnerExtras.FlipVisualYRotation, PartnerExtras.FlipVisualXScale);
+
+	// Work in the flipped visual space so manipulators already mirrored with the flip settings still move as a pair, then reflect the delta across X.
+	FVector DeltaLocation = VisualTransformWithDelta.GetLocation() - VisualTransform.GetLocation();
+	DeltaLocation.X = -DeltaLocation.X;
+	const FQuat DeltaRotation = VisualTransformWithDelta.GetRotation() * VisualTransform.GetRotation().Inverse();
+	const FQuat MirroredDeltaRotation = FQuat(DeltaRotation.X, -DeltaRotation.Y, -DeltaRotation.Z, DeltaRotation.W);
+
+	PartnerTransform.SetLocation(PartnerTransform.GetLocation() + DeltaLocation);
+	PartnerTransform.SetRotation((MirroredDeltaRotation * PartnerTransform.GetRotation()).GetNormalized());
+	PartnerTransform.SetScale3D(PartnerTransform.GetScale3D() + VisualTransformWithDelta.GetScale3D() - VisualTransform.GetScale3D());
+
+	PartnerTransform = FlipTransformOnX(PartnerTransform, PartnerExtras.FlipVisualXLocation, PartnerExtras.FlipVisualYRotation, PartnerExtras.FlipVisualXScale);
+
+	FManipulatorEdit Edit;
+	Edit.Object = PartnerObject;
+	Edit.Property = PartnerProperty;
+	Edit.PropertyIndex = PartnerIndex;
+	Edit.Value = PartnerComponent->ConstrainTransform(PartnerTransform);
+	InOutEdits.Add(Edit);
+}
+
+UObject * FManipulatorToolsEditorEdMode::GetObjectToDisplayWidgetsFromManipulator(/*FTransform & OutLocalToWorld, */ const FManipulatorHandle& Manipulator) const
+{
+	// Determine what is selected, preferring a component over an actor
+	UObject* BestSelectedItem = Manipulator.GetActor();
+	//OutLocalToWorld = GetManipulatorTransformWithOffsets(ManipulatorComponent);
+	return BestSelectedItem;
 }
 
 /* ---------- Private Transform Manipulation ----------*/
 
-FTransform FManipulatorToolsEditorEdMode::HandleFinalShapeTransforms(FTransform ShapeTransform, FTransform OverallScale, FTransform WidgetTransform, bool RotateScale)
+FTransform FManipulatorToolsEditorEdMode::HandleFinalShapeTransform(const FTransform& ShapeTransform, FTransform WidgetTransform, bool RotateScale) const
 {
 	if (RotateScale)
 	{
 		WidgetTransform.SetScale3D(ShapeTransform.GetRotation().Inverse().RotateVector(WidgetTransform.GetScale3D()));
 	}
-	return ShapeTransform * OverallScale * WidgetTransform;
+	return ShapeTransform * WidgetTransform;
 }
 
 FTransform FManipulatorToolsEditorEdMode::FlipTransformOnX(FTransform Transform, bool FlipXVector, bool FlipYRotation, bool FlipXScale) const
@@ -898,56 +1909,61 @@ FTransform FManipulatorToolsEditorEdMode::FlipTransformOnX(FTransform Transform,
 	return Transform;
 }
 
-void FManipulatorToolsEditorEdMode::AddNewSelectedManipulator(UManipulatorComponent* ManipulatorComponent)
+void FManipulatorToolsEditorEdMode::AddNewSelectedManipulator(const FManipulatorHandle& Manipulator, int32 PropertyIndex)
 {
-	if (IsValid(ManipulatorComponent) && IsValid(ManipulatorComponent->GetOwner()))
+	if (Manipulator.IsValid())
 	{
-		if (!IsManipulatorSelected(ManipulatorComponent))
+		if (!IsManipulatorSelected(Manipulator, PropertyIndex))
 		{
+			const UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
 			FManipulatorData* NewData = new FManipulatorData();
-			NewData->ID = ManipulatorComponent->GetManipulatorID();
-			NewData->ActorName = ManipulatorComponent->GetName();
-			NewData->ActorSequencerName = ManipulatorComponent->GetOwner()->GetActorLabel();
-			NewData->ComponentName = ManipulatorComponent->GetName();
+			NewData->ID = Manipulator.GetID(PropertyIndex);
+			NewData->ManipulatorGuid = Manipulator.Guid;
+			NewData->ActorName = Manipulator.GetName().ToString();
+			NewData->ActorSequencerName = Manipulator.GetActor()->GetActorLabel();
+			NewData->ComponentName = Manipulator.GetName().ToString();
 			NewData->PropertyName = ManipulatorComponent->Settings.Property.NameToEdit;
-			NewData->PropertyIndex = ManipulatorComponent->Settings.Property.Index;
+			NewData->PropertyIndex = ManipulatorComponent->DrivesAllArrayElements() ? PropertyIndex : ManipulatorComponent->Settings.Property.Index;
 			NewData->PropertyType = ManipulatorComponent->Settings.Property.Type;
-			NewData->ActorUniqueID = ManipulatorComponent->GetOwner()->GetUniqueID();
+			NewData->ActorUniqueID = Manipulator.GetActor()->GetUniqueID();
 			if (NewData->PropertyType != EManipulatorPropertyType::MT_BOOL)
 			{
 				NewSelectedManipulators.Add(NewData);
+				InvalidateManipulatorFrame();
 			}
 		}
 	}
 }
 
-void FManipulatorToolsEditorEdMode::ToggleSelectedManipulator(UManipulatorComponent * ManipulatorComponent)
+void FManipulatorToolsEditorEdMode::ToggleSelectedManipulator(const FManipulatorHandle& Manipulator, int32 PropertyIndex)
 {
-	if (IsValid(ManipulatorComponent))
+	if (Manipulator.IsValid())
 	{
-		if (IsManipulatorSelected(ManipulatorComponent))
+		if (IsManipulatorSelected(Manipulator, PropertyIndex))
 		{
-			RemoveSelectedManipulator(ManipulatorComponent);
+			RemoveSelectedManipulator(Manipulator, PropertyIndex);
 		}
 		else
 		{
-			AddNewSelectedManipulator(ManipulatorComponent);
+			AddNewSelectedManipulator(Manipulator, PropertyIndex);
 		}
 	}
 
 }
 
-void FManipulatorToolsEditorEdMode::RemoveSelectedManipulator(UManipulatorComponent * ManipulatorComponent)
+void FManipulatorToolsEditorEdMode::RemoveSelectedManipulator(const FManipulatorHandle& Manipulator, int32 PropertyIndex)
 {
-	if (IsValid(ManipulatorComponent) && IsManipulatorSelected(ManipulatorComponent))
+	if (Manipulator.IsValid() && IsManipulatorSelected(Manipulator, PropertyIndex))
 	{
+		const FString ManipulatorID = Manipulator.GetID(PropertyIndex);
 		for (int32 i = 0; i < NewSelectedManipulators.Num(); i++)
 		{
 			if (NewSelectedManipulators.IsValidIndex(i))
 			{
-				if (NewSelectedManipulators[i]->ID == ManipulatorComponent->GetManipulatorID())
+				if (NewSelectedManipulators[i]->ID == ManipulatorID)
 				{
 					NewSelectedManipulators.RemoveAt(i);
+					InvalidateManipulatorFrame();
 					return;
 				}
 			}
@@ -955,14 +1971,22 @@ void FManipulatorToolsEditorEdMode::RemoveSelectedManipulator(UManipulatorCompon
 	}
 }
 
-bool FManipulatorToolsEditorEdMode::IsManipulatorSelected(UManipulatorComponent * ManipulatorComponent)
+bool FManipulatorToolsEditorEdMode::IsManipulatorSelected(const FManipulatorHandle& Manipulator, int32 PropertyIndex)
 {
-	// Check if Manipulator ID already exists
-	if (IsValid(ManipulatorComponent))
+	// Runs for every drawn element each frame so it compares the guid and index rather than building the ID string, they identify the same manipulator.
+	if (Manipulator.IsValid() && NewSelectedManipulators.Num() > 0)
 	{
+		const UManipulatorComponent* ManipulatorComponent = Manipulator.GetComponent();
+		const FGuid& ManipulatorGuid = Manipulator.Guid;
+		if (ManipulatorGuid.IsValid() == false)
+		{
+			return false;
+		}
+		// Same index the selection data is stored with.
+		const int32 SelectedIndex = ManipulatorComponent->DrivesAllArrayElements() ? PropertyIndex : ManipulatorComponent->Settings.Property.Index;
 		for (FManipulatorData* SelectedManipulator : NewSelectedManipulators)
 		{
-			if (SelectedManipulator->ID == ManipulatorComponent->GetManipulatorID())
+			if (SelectedManipulator->PropertyIndex == SelectedIndex && SelectedManipulator->ManipulatorGuid == ManipulatorGuid)
 			{
 				return true;
 			}
@@ -982,15 +2006,15 @@ void FManipulatorToolsEditorEdMode::FindAndAddNewManipulatorSelection(FString Pr
 		{
 			if (SelectedActor->GetActorLabel() == ActorSequencerName)
 			{
-				TArray<UActorComponent*> Manipulators = SelectedActor->GetComponentsByClass(UManipulatorComponent::StaticClass());
-				for (UActorComponent* ActorComponent : Manipulators)
+				TArray<FManipulatorHandle> Manipulators;
+				FManipulatorDescriptors::GetActorManipulators(SelectedActor, Manipulators);
+				for (const FManipulatorHandle& Manipulator : Manipulators)
 				{
-					UManipulatorComponent* ManipulatorComponent = Cast<UManipulatorComponent>(ActorComponent);
-					if (IsValid(ManipulatorComponent))
+					if (Manipulator.IsValid())
 					{
-						if (ManipulatorComponent->Settings.Property.NameToEdit == PropertyName)
+						if (Manipulator.GetComponent()->Settings.Property.NameToEdit == PropertyName)
 						{
-							AddNewSelectedManipulator(ManipulatorComponent);
+							AddNewSelectedManipulator(Manipulator, Manipulator.GetComponent()->Settings.Property.Index);
 							return;
 						}
 					}
@@ -1000,30 +2024,119 @@ void FManipulatorToolsEditorEdMode::FindAndAddNewManipulatorSelection(FString Pr
 	}
 }
 
-FManipulatorData * FManipulatorToolsEditorEdMode::GetManipulatorData(UManipulatorComponent * ManipulatorComponent)
+/* ---------- Input Recording ----------*/
+
+void FManipulatorToolsEditorEdMode::StartInputRecording()
+{
+	InputRecording = MakeUnique<FManipulatorInputRecording>();
+	InputRecording->MapName = GetWorld() ? GetWorld()->GetOutermost()->GetName() : FString();
+	InputRecordingStartSeconds = FPlatformTime::Seconds();
+
+	// Replays start from whatever is selected now.
+	RecordActorSelection();
+}
+
+bool FManipulatorToolsEditorEdMode::StopInputRecording(FManipulatorInputRecording& OutRecording)
 {
-	FManipulatorData* ManipulatorData = new FManipulatorData();
-	if (IsValid(ManipulatorComponent))
+	if (InputRecording.IsValid() == false)
 	{
-		for (FManipulatorData* SelectedManipulator : NewSelectedManipulators)
+		return false;
+	}
+	InputRecording->CaptureFinalPoses();
+	OutRecording = MoveTemp(*InputRecording);
+	InputRecording.Reset();
+	return true;
+}
+
+void FManipulatorToolsEditorEdMode::RecordInputEvent(FManipulatorInputEvent& Event)
+{
+	Event.Seconds = FPlatformTime::Seconds() - InputRecordingStartSeconds;
+	InputRecording->Events.Add(MoveTemp(Event));
+}
+
+void FManipulatorToolsEditorEdMode::RecordActorSelection()
+{
+	if (InputRecording.IsValid() == false)
+	{
+		return;
+	}
+
+	TArray<AActor*> SelectedActors;
+	GEditor->GetSelectedActors()->GetSelectedObjects(SelectedActors);
+	FManipulatorInputEvent Event;
+	Event.Type = EManipulatorInputEventType::SelectActors;
+	for (AActor* SelectedActor : SelectedActors)
+	{
+		if (IsValid(SelectedActor))
+		{
+			Event.Actors.Add(SelectedActor->GetPathName());
+			InputRecording->AddActor(SelectedActor);
+		}
+	}
+	RecordInputEvent(Event);
+}
+
+void FManipulatorToolsEditorEdMode::ReplayInputEvent(const FManipulatorInputEvent& Event)
+{
+	switch (Event.Type)
+	{
+	case EManipulatorInputEventType::SelectActors:
+	{
+		GEditor->SelectNone(false, true);
+		for (const FString& ActorPath : Event.Actors)
+		{
+			if (AActor* Actor = FindObject<AActor>(nullptr, *ActorPath))
+			{
+				GEditor->SelectActor(Actor, true, false);
+			}
+		}
+		GEditor->NoteSelectionChange();
+		break;
+	}
+	case EManipulatorInputEventType::Click:
+	{
+		FManipulatorHandle Manipulator;
+		if (FManipulatorDescriptors::FindManipulator(Event.Target.ManipulatorGuid, Manipulator) && Manipulator.IsValid())
 		{
-			if (SelectedManipulator->ID == ManipulatorComponent->GetManipulatorID())
+			ClickManipulator(Manipulator, Event.Target.PropertyIndex, Event.bControlDown, Event.bShiftDown);
+		}
+		break;
+	}
+	case EManipulatorInputEventType::BeginDrag:
+	{
+		// Put the selection back the way it was when the drag started, whatever clicks were or weren't recorded before it.
+		ClearManipulatorSelection();
+		for (const FManipulatorInputSelection& Selection : Event.Selection)
+		{
+			FManipulatorHandle Manipulator;
+			if (FManipulatorDescriptors::FindManipulator(Selection.ManipulatorGuid, Manipulator))
 			{
-				return SelectedManipulator;
+				AddNewSelectedManipulator(Manipulator, Selection.PropertyIndex);
 			}
 		}
+		UpdateManipulatorFrame();
+		BeginManipulatorDrag((EAxisList::Type)Event.Axis);
+		break;
+	}
+	case EManipulatorInputEventType::Delta:
+		ApplyManipulatorInputDelta((EAxisList::Type)Event.Axis, Event.Drag, Event.Rot, Event.Scale);
+		FlushPendingKeys();
+		break;
+	case EManipulatorInputEventType::EndDrag:
+		EndManipulatorDrag();
+		break;
 	}
-	return ManipulatorData;
+
+	// Selection changes only take effect when a frame renders, settle them after every event the way the viewport would.
+	InvalidateManipulatorFrame();
+	UpdateManipulatorFrame();
 }
 
 void FManipulatorToolsEditorEdMode::ClearManipulatorSelection()
 {
 	NewSelectedManipulators.Empty();
 	bEditedPropertyIsTransform = false;
+	InvalidateManipulatorFrame();
 }
 
-
-
-
-
-
+#undef LOCTEXT_NAMESPACE
@@ -6,7 +6,11 @@
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SCheckBox.h"
 #include "Widgets/Text/STextBlock.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Input/SSpinBox.h"
 #include "EditorModeManager.h"
+#include "PropertyCustomizationHelpers.h"
+#include "ManipulatorPoseLibrary.h"
 
 #define LOCTEXT_NAMESPACE "FManipulatorToolsEditorEdModeToolkit"
 
@@ -61,6 +65,153 @@ void FManipulatorToolsEditorEdModeToolkit::Init(const TSharedPtr<IToolkitHost>&
 					.Text(LOCTEXT("UseSafeDeSelectCheckbox", "Use Safe DeSelect"))
 				]
 			]
+			+ SVerticalBox::Slot()
+			.Padding(5)
+			.AutoHeight()
+			.HAlign(HAlign_Left)
+			[
+				SNew(SCheckBox)
+				.OnCheckStateChanged(this, &FManipulatorToolsEditorEdModeToolkit::OnUseMirrorEditingChanged)
+				.IsChecked(this, &FManipulatorToolsEditorEdModeToolkit::UseMirrorEditing)
+				.ToolTipText(LOCTEXT("UseMirrorEditingToolTip", "Dragging a manipulator also moves its left/right partner, mirrored across X. Partners are found by name (_L/_R, Left/Right) or set with Mirror Partner on the component."))
+				.Content()
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("UseMirrorEditingCheckbox", "Mirror Edits"))
+				]
+			]
+			+ SVerticalBox::Slot()
+			.Padding(5)
+			.AutoHeight()
+			.HAlign(HAlign_Left)
+			[
+				SNew(SHorizontalBox) + SHorizontalBox::Slot()
+				.AutoWidth()
+				.Padding(0, 0, 5, 0)
+				[
+					SNew(SButton)
+					.Text(LOCTEXT("CopyPoseButton", "Copy Pose"))
+					.ToolTipText(LOCTEXT("CopyPoseToolTip", "Copies every manipulator value on the selected actors."))
+					.OnClicked(this, &FManipulatorToolsEditorEdModeToolkit::OnCopyPoseClicked)
+				]
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				[
+					SNew(SButton)
+					.Text(LOCTEXT("PastePoseButton", "Paste Pose"))
+					.ToolTipText(LOCTEXT("PastePoseToolTip", "Pastes the copied manipulator values onto the selected actors as a single undo step."))
+					.OnClicked(this, &FManipulatorToolsEditorEdModeToolkit::OnPastePoseClicked)
+					.IsEnabled(this, &FManipulatorToolsEditorEdModeToolkit::CanPastePose)
+				]
+			]
+			+ SVerticalBox::Slot()
+			.Padding(5)
+			.AutoHeight()
+			.HAlign(HAlign_Left)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("BakeToSequencerButton", "Bake To Sequencer"))
+				.ToolTipText(LOCTEXT("BakeToSequencerToolTip", "Keys every manipulated property on the selected actors on each frame of the sequencer selection range, or the playback range if nothing is selected."))
+				.OnClicked(this, &FManipulatorToolsEditorEdModeToolkit::OnBakeToSequencerClicked)
+				.IsEnabled(this, &FManipulatorToolsEditorEdModeToolkit::CanBakeToSequencer)
+			]
+			+ SVerticalBox::Slot()
+			.Padding(5)
+			.AutoHeight()
+			.HAlign(HAlign_Left)
+			[
+				SNew(SHorizontalBox) + SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				.Padding(0, 0, 5, 0)
+				[
+					SNew(SCheckBox)
+					.OnCheckStateChanged(this, &FManipulatorToolsEditorEdModeToolkit::OnReduceKeysOnReleaseChanged)
+					.IsChecked(this, &FManipulatorToolsEditorEdModeToolkit::ReduceKeysOnRelease)
+					.ToolTipText(LOCTEXT("ReduceKeysOnReleaseToolTip", "When a drag auto-keys transforms or vectors, removes keys that can be dropped without the curve moving more than the tolerance once the drag is released."))
+					.Content()
+					[
+						SNew(STextBlock)
+						.Text(LOCTEXT("ReduceKeysOnReleaseCheckbox", "Reduce Keys On Release"))
+					]
+				]
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.VAlign(VAlign_Center)
+				[
+					SNew(SSpinBox<float>)
+					.MinValue(0.0f)
+					.MinDesiredWidth(60.0f)
+					.Delta(0.001f)
+					.Value(this, &FManipulatorToolsEditorEdModeToolkit::GetKeyReductionTolerance)
+					.OnValueChanged(this, &FManipulatorToolsEditorEdModeToolkit::OnKeyReductionToleranceChanged)
+					.ToolTipText(LOCTEXT("KeyReductionToleranceToolTip", "How far the curve may move when keys are reduced."))
+				]
+			]
+			+ SVerticalBox::Slot()
+			.Padding(5)
+			.AutoHeight()
+			[
+				SNew(SObjectPropertyEntryBox)
+				.AllowedClass(UManipulatorPoseLibrary::StaticClass())
+				.ObjectPath(this, &FManipulatorToolsEditorEdModeToolkit::GetPoseLibraryPath)
+				.OnObjectChanged(this, &FManipulatorToolsEditorEdModeToolkit::OnPoseLibraryChanged)
+				.AllowClear(true)
+				.DisplayThumbnail(false)
+			]
+			+ SVerticalBox::Slot()
+			.Padding(5)
+			.AutoHeight()
+			.HAlign(HAlign_Left)
+			[
+				SNew(SHorizontalBox) + SHorizontalBox::Slot()
+				.AutoWidth()
+				.Padding(0, 0, 5, 0)
+				[
+					SAssignNew(PoseNameComboBox, SComboBox<TSharedPtr<FName>>)
+					.OptionsSource(&PoseNames)
+					.OnGenerateWidget(this, &FManipulatorToolsEditorEdModeToolkit::MakePoseNameWidget)
+					.OnSelectionChanged(this, &FManipulatorToolsEditorEdModeToolkit::OnPoseNameSelected)
+					.Content()
+					[
+						SNew(STextBlock)
+						.Text(this, &FManipulatorToolsEditorEdModeToolkit::GetSelectedPoseNameText)
+					]
+				]
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				[
+					SNew(SButton)
+					.Text(LOCTEXT("ApplyLibraryPoseButton", "Apply Pose"))
+					.ToolTipText(LOCTEXT("ApplyLibraryPoseToolTip", "Applies the chosen pose from the library to the selected actors."))
+					.OnClicked(this, &FManipulatorToolsEditorEdModeToolkit::OnApplyLibraryPoseClicked)
+					.IsEnabled(this, &FManipulatorToolsEditorEdModeToolkit::CanApplyLibraryPose)
+				]
+			]
+			+ SVerticalBox::Slot()
+			.Padding(5)
+			.AutoHeight()
+			.HAlign(HAlign_Left)
+			[
+				SNew(SHorizontalBox) + SHorizontalBox::Slot()
+				.AutoWidth()
+				.Padding(0, 0, 5, 0)
+				[
+					SNew(SEditableTextBox)
+					.MinDesiredWidth(120.0f)
+					.HintText(LOCTEXT("NewPoseNameHint", "Pose Name"))
+					.OnTextChanged(this, &FManipulatorToolsEditorEdModeToolkit::OnNewPoseNameChanged)
+				]
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				[
+					SNew(SButton)
+					.Text(LOCTEXT("SaveLibraryPoseButton", "Save Pose"))
+					.ToolTipText(LOCTEXT("SaveLibraryPoseToolTip", "Saves the manipulator values of the selected actors into the library, replacing any pose with the same name."))
+					.OnClicked(this, &FManipulatorToolsEditorEdModeToolkit::OnSaveLibraryPoseClicked)
+					.IsEnabled(this, &FManipulatorToolsEditorEdModeToolkit::CanSaveLibraryPose)
+				]
+			]
 		];
 	FModeToolkit::Init(InitToolkitHost);
 }
@@ -118,6 +269,168 @@ void FManipulatorToolsEditorEdModeToolkit::OnUseSafeDeSelectChanged(ECheckBoxSta
 	}
 }
 
+ECheckBoxState FManipulatorToolsEditorEdModeToolkit::UseMirrorEditing() const
+{
+	if (GetManipulatorToolsEdMode())
+	{
+		return GetManipulatorToolsEdMode()->GetUseMirrorEditing() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+	}
+	return ECheckBoxState::Unchecked;
+}
+
+void FManipulatorToolsEditorEdModeToolkit::OnUseMirrorEditingChanged(ECheckBoxState NewCheckedState)
+{
+	if (GetEditorMode())
+	{
+		GetManipulatorToolsEdMode()->UpdateUseMirrorEditing(NewCheckedState == ECheckBoxState::Checked);
+	}
+}
+
+ECheckBoxState FManipulatorToolsEditorEdModeToolkit::ReduceKeysOnRelease() const
+{
+	if (GetManipulatorToolsEdMode())
+	{
+		return GetManipulatorToolsEdMode()->GetReduceKeysOnRelease() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+	}
+	return ECheckBoxState::Unchecked;
+}
+
+void FManipulatorToolsEditorEdModeToolkit::OnReduceKeysOnReleaseChanged(ECheckBoxState NewCheckedState)
+{
+	if (GetEditorMode())
+	{
+		GetManipulatorToolsEdMode()->UpdateReduceKeysOnRelease(NewCheckedState == ECheckBoxState::Checked);
+	}
+}
+
+float FManipulatorToolsEditorEdModeToolkit::GetKeyReductionTolerance() const
+{
+	return GetManipulatorToolsEdMode() ? GetManipulatorToolsEdMode()->GetKeyReductionTolerance() : 0.0f;
+}
+
+void FManipulatorToolsEditorEdModeToolkit::OnKeyReductionToleranceChanged(float NewValue)
+{
+	if (GetEditorMode())
+	{
+		GetManipulatorToolsEdMode()->UpdateKeyReductionTolerance(NewValue);
+	}
+}
+
+FReply FManipulatorToolsEditorEdModeToolkit::OnCopyPoseClicked()
+{
+	if (GetManipulatorToolsEdMode())
+	{
+		GetManipulatorToolsEdMode()->CopyManipulatorPose();
+	}
+	return FReply::Handled();
+}
+
+FReply FManipulatorToolsEditorEdModeToolkit::OnPastePoseClicked()
+{
+	if (GetManipulatorToolsEdMode())
+	{
+		GetManipulatorToolsEdMode()->PasteManipulatorPose();
+	}
+	return FReply::Handled();
+}
+
+bool FManipulatorToolsEditorEdModeToolkit::CanPastePose() const
+{
+	return GetManipulatorToolsEdMode() && GetManipulatorToolsEdMode()->HasCopiedManipulatorPose();
+}
+
+FReply FManipulatorToolsEditorEdModeToolkit::OnBakeToSequencerClicked()
+{
+	if (GetManipulatorToolsEdMode())
+	{
+		GetManipulatorToolsEdMode()->BakeSelectedManipulatorsToSequencer();
+	}
+	return FReply::Handled();
+}
+
+bool FManipulatorToolsEditorEdModeToolkit::CanBakeToSequencer() const
+{
+	return GetManipulatorToolsEdMode() && GetManipulatorToolsEdMode()->CanBakeToSequencer();
+}
+
+FString FManipulatorToolsEditorEdModeToolkit::GetPoseLibraryPath() const
+{
+	return PoseLibrary.IsValid() ? PoseLibrary->GetPathName() : FString();
+}
+
+void FManipulatorToolsEditorEdModeToolkit::OnPoseLibraryChanged(const FAssetData& AssetData)
+{
+	// Only the pose entries come in with the asset, values stay on disk until a pose is applied.
+	PoseLibrary = Cast<UManipulatorPoseLibrary>(AssetData.GetAsset());
+	SelectedPoseName.Reset();
+	RefreshPoseNames();
+}
+
+void FManipulatorToolsEditorEdModeToolkit::RefreshPoseNames()
+{
+	PoseNames.Reset();
+	if (PoseLibrary.IsValid())
+	{
+		for (const FManipulatorPoseLibraryEntry& Entry : PoseLibrary->GetPoses())
+		{
+			PoseNames.Add(MakeShareable(new FName(Entry.Name)));
+		}
+	}
+	if (PoseNameComboBox.IsValid())
+	{
+		PoseNameComboBox->RefreshOptions();
+	}
+}
+
+TSharedRef<SWidget> FManipulatorToolsEditorEdModeToolkit::MakePoseNameWidget(TSharedPtr<FName> PoseName) const
+{
+	return SNew(STextBlock).Text(FText::FromName(*PoseName));
+}
+
+void FManipulatorToolsEditorEdModeToolkit::OnPoseNameSelected(TSharedPtr<FName> PoseName, ESelectInfo::Type SelectInfo)
+{
+	SelectedPoseName = PoseName;
+}
+
+FText FManipulatorToolsEditorEdModeToolkit::GetSelectedPoseNameText() const
+{
+	return SelectedPoseName.IsValid() ? FText::FromName(*SelectedPoseName) : LOCTEXT("NoPoseSelected", "Choose Pose");
+}
+
+void FManipulatorToolsEditorEdModeToolkit::OnNewPoseNameChanged(const FText& InText)
+{
+	NewPoseName = InText;
+}
+
+FReply FManipulatorToolsEditorEdModeToolkit::OnApplyLibraryPoseClicked()
+{
+	if (GetManipulatorToolsEdMode() && CanApplyLibraryPose())
+	{
+		GetManipulatorToolsEdMode()->ApplyLibraryPose(PoseLibrary.Get(), PoseLibrary->FindPoseIndex(*SelectedPoseName));
+	}
+	return FReply::Handled();
+}
+
+FReply FManipulatorToolsEditorEdModeToolkit::OnSaveLibraryPoseClicked()
+{
+	if (GetManipulatorToolsEdMode() && CanSaveLibraryPose())
+	{
+		GetManipulatorToolsEdMode()->SaveLibraryPose(PoseLibrary.Get(), FName(*NewPoseName.ToString()));
+		RefreshPoseNames();
+	}
+	return FReply::Handled();
+}
+
+bool FManipulatorToolsEditorEdModeToolkit::CanApplyLibraryPose() const
+{
+	return PoseLibrary.IsValid() && SelectedPoseName.IsValid();
+}
+
+bool FManipulatorToolsEditorEdModeToolkit::CanSaveLibraryPose() const
+{
+	return PoseLibrary.IsValid() && !NewPoseName.IsEmptyOrWhitespace();
+}
+
 FName FManipulatorToolsEditorEdModeToolkit::GetToolkitFName() const
 {
 	return FName("ManipulatorToolsEditorEdMode");
@@ -0,0 +1,134 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#include "ManipulatorValidateCommandlet.h"
+#include "ManipulatorAssetIndex.h"
+#include "Engine/Blueprint.h"
+#include "Async/ParallelFor.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogManipulatorValidate, Log, All);
+
+namespace
+{
+	struct FManipulatorValidation
+	{
+		FManipulatorAssetInfo Info;
+		/** Native parent found on the game thread, class layout is only read from the workers. */
+		const UClass* NativeParentClass = nullptr;
+		bool bNeedsDeepCheck = false;
+		TArray<FString> Errors;
+	};
+
+	/** Checks a binding against what the tags say, reading only native class layout. */
+	void ValidateTaggedBinding(const FManipulatorAssetBinding& Binding, FManipulatorValidation& Validation)
+	{
+		switch (Binding.Source)
+		{
+		case EManipulatorBindingSource::Unresolved:
+			Validation.Errors.Add(FString::Printf(TEXT("%s drives '%s' which wasn't a matching property when the blueprint was saved."), *Binding.ManipulatorName.ToString(), *Binding.PropertyName));
+			break;
+		case EManipulatorBindingSource::Native:
+			// Native properties can be renamed without the blueprint being resaved, which is the case tags alone can still catch.
+			if (Validation.NativeParentClass == nullptr)
+			{
+				Validation.bNeedsDeepCheck = true;
+			}
+			else if (FManipulatorAssetIndex::CanBindProperty(Validation.NativeParentClass, Binding.PropertyName, Binding.Type) == false)
+			{
+				Validation.Errors.Add(FString::Printf(TEXT("%s drives '%s' which is no longer a matching property on %s."), *Binding.ManipulatorName.ToString(), *Binding.PropertyName, *Validation.NativeParentClass->GetName()));
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	void ValidateLoadedBlueprint(FManipulatorValidation& Validation)
+	{
+		Validation.Errors.Reset();
+		const UBlueprint* Blueprint = Cast<UBlueprint>(Validation.Info.Asset.GetAsset());
+		if (Blueprint == nullptr || Blueprint->GeneratedClass == nullptr)
+		{
+			Validation.Errors.Add(TEXT("Couldn't load the blueprint."));
+			return;
+		}
+
+		TArray<FManipulatorAssetBinding> Bindings;
+		TArray<FSoftObjectPath> Presets;
+		FManipulatorAssetIndex::GatherBlueprintManipulators(Blueprint, Bindings, Presets);
+		for (const FManipulatorAssetBinding& Binding : Bindings)
+		{
+			if (FManipulatorAssetIndex::CanBindProperty(Blueprint->GeneratedClass, Binding.PropertyName, Binding.Type) == false)
+			{
+				Validation.Errors.Add(FString::Printf(TEXT("%s drives '%s' which isn't a matching property on %s."), *Binding.ManipulatorName.ToString(), *Binding.PropertyName, *Blueprint->GeneratedClass->GetName()));
+			}
+		}
+	}
+}
+
+UManipulatorValidateCommandlet::UManipulatorValidateCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UManipulatorValidateCommandlet::Main(const FString& Params)
+{
+	const bool bDeep = FParse::Param(*Params, TEXT("Deep"));
+	FString PathFilter;
+	FParse::Value(*Params, TEXT("Path="), PathFilter);
+
+	TArray<FManipulatorAssetInfo> Infos;
+	FManipulatorAssetIndex::FindManipulatorBlueprints(Infos, true);
+
+	TArray<FManipulatorValidation> Validations;
+	for (FManipulatorAssetInfo& Info : Infos)
+	{
+		if (PathFilter.IsEmpty() == false && Info.Asset.PackageName.ToString().StartsWith(PathFilter) == false)
+		{
+			continue;
+		}
+		FManipulatorValidation& Validation = Validations[Validations.AddDefaulted()];
+		Validation.NativeParentClass = Info.NativeParentClassPath.IsEmpty() ? nullptr : FindObject<UClass>(nullptr, *Info.NativeParentClassPath);
+		Validation.bNeedsDeepCheck = Info.bTagsCurrent == false;
+		Validation.Info = MoveTemp(Info);
+	}
+
+	// Tag checks only read strings and native class layout so every blueprint can be checked at once.
+	ParallelFor(Validations.Num(), [&Validations](int32 ValidationIndex)
+	{
+		FManipulatorValidation& Validation = Validations[ValidationIndex];
+		if (Validation.bNeedsDeepCheck == false)
+		{
+			for (const FManipulatorAssetBinding& Binding : Validation.Info.Bindings)
+			{
+				ValidateTaggedBinding(Binding, Validation);
+			}
+		}
+	});
+
+	// Loading has to happen on the game thread.
+	int32 NumLoaded = 0;
+	for (FManipulatorValidation& Validation : Validations)
+	{
+		if (Validation.bNeedsDeepCheck || (bDeep && Validation.Errors.Num() > 0))
+		{
+			ValidateLoadedBlueprint(Validation);
+			NumLoaded++;
+		}
+	}
+
+	int32 NumBroken = 0;
+	for (const FManipulatorValidation& Validation : Validations)
+	{
+		for (const FString& Error : Validation.Errors)
+		{
+			UE_LOG(LogManipulatorValidate, Error, TEXT("%s: %s"), *Validation.Info.Asset.ObjectPath.ToString(), *Error);
+		}
+		NumBroken += Validation.Errors.Num();
+	}
+
+	UE_LOG(LogManipulatorValidate, Display, TEXT("Checked %d blueprints, loaded %d, found %d broken manipulator bindings."), Validations.Num(), NumLoaded, NumBroken);
+	return NumBroken > 0 ? 1 : 0;
+}
@@ -0,0 +1,79 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetData.h"
+#include "ManipulatorComponent.h"
+
+class UBlueprint;
+
+/** Where a manipulator's NameToEdit was found when the blueprint was last saved. */
+enum class EManipulatorBindingSource : uint8
+{
+	/** On the native parent class, so it can be checked again without loading the blueprint. */
+	Native,
+	/** On a blueprint variable. */
+	Blueprint,
+	/** Nowhere, or on a property of the wrong type. */
+	Unresolved
+};
+
+/** One manipulator of a blueprint and the property it drives. */
+struct FManipulatorAssetBinding
+{
+	/** Component variable name, or the property name for manipulators declared through metadata. */
+	FName ManipulatorName;
+	FString PropertyName;
+	EManipulatorPropertyType Type = EManipulatorPropertyType::MT_TRANSFORM;
+	EManipulatorBindingSource Source = EManipulatorBindingSource::Unresolved;
+};
+
+/** Manipulator tags of one blueprint asset. */
+struct FManipulatorAssetInfo
+{
+	FAssetData Asset;
+	/** False when the tags were written by an older version or not at all, the blueprint has to be loaded to know anything about it. */
+	bool bTagsCurrent = false;
+	int32 NumManipulators = 0;
+	TArray<FManipulatorAssetBinding> Bindings;
+	TArray<FSoftObjectPath> Presets;
+	/** Path of the first native class the blueprint derives from. */
+	FString NativeParentClassPath;
+};
+
+/**
+ * Manipulator layout of blueprints saved as asset registry tags so they can be found without loading them.
+ * Tags are written whenever a blueprint is saved, blueprints saved before the plugin wrote tags come back with bTagsCurrent false.
+ * The ManipulatorValidate commandlet checks every NameToEdit from these tags.
+ */
+class FManipulatorAssetIndex
+{
+public:
+	static const FName CountTag;
+	static const FName PropertiesTag;
+	static const FName PresetsTag;
+	static const FName VersionTag;
+
+	/** Adds the manipulator tags to every blueprint's asset registry tags. */
+	static void Register();
+	static void Unregister();
+
+	/** Reads the tags of a blueprint asset, false when it has no manipulators according to its tags. Stale tags still return true so they can be deep checked. */
+	static bool GetAssetInfo(const FAssetData& Asset, FManipulatorAssetInfo& OutInfo);
+
+	/** Every blueprint using manipulators, optionally waiting for the asset registry to finish scanning first. */
+	static void FindManipulatorBlueprints(TArray<FManipulatorAssetInfo>& OutInfos, bool bWaitForScan = false);
+
+	/** Blueprints with a manipulator driving PropertyName. */
+	static void FindBlueprintsDrivingProperty(const FString& PropertyName, TArray<FManipulatorAssetInfo>& OutInfos);
+
+	/** Blueprints with a manipulator drawn with Preset. */
+	static void FindBlueprintsUsingPreset(const FSoftObjectPath& Preset, TArray<FManipulatorAssetInfo>& OutInfos);
+
+	/** Manipulators of a loaded blueprint including those inherited from parent blueprints, with the child's overrides applied. What the tags are written from. */
+	static void GatherBlueprintManipulators(const UBlueprint* Blueprint, TArray<FManipulatorAssetBinding>& OutBindings, TArray<FSoftObjectPath>& OutPresets);
+
+	/** Whether a NameToEdit path names a property of Struct the manipulator type can drive. Only reads class layout so it can run off the game thread. */
+	static bool CanBindProperty(const UStruct* Struct, const FString& PropertyName, EManipulatorPropertyType Type);
+};
@@ -0,0 +1,100 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/StrongObjectPtr.h"
+#include "ManipulatorComponent.h"
+
+class AActor;
+class UManipulatorPreset;
+
+/** A manipulator a class declares through property metadata rather than by adding a component. */
+struct FManipulatorDescriptor
+{
+	/** Name the manipulator goes by on each actor, this is the property name. */
+	FName Name;
+	FManipulatorSettingsMainProperty Property;
+	/** Draw and constraint settings, left empty to draw with the default settings. */
+	FSoftObjectPath Preset;
+
+	/** Loads Preset the first time it's asked for, every actor of the class then shares the result instead of looking it up again. */
+	UManipulatorPreset* GetPreset() const;
+
+	/** Settings every actor of the class draws and edits this manipulator with, a single transient object made the first time it's asked for. */
+	UManipulatorComponent* GetSharedSettings() const;
+
+private:
+	mutable TWeakObjectPtr<UManipulatorPreset> LoadedPreset;
+	mutable bool bPresetResolved = false;
+	mutable TStrongObjectPtr<UManipulatorComponent> SharedSettings;
+};
+
+/**
+ * A manipulator on an actor, either one of its manipulator components or one its class declares on a property.
+ * Declared manipulators point at their class's shared settings, so all an actor adds is this handle.
+ */
+struct FManipulatorHandle
+{
+	FManipulatorHandle() {}
+	explicit FManipulatorHandle(UManipulatorComponent* InComponent);
+
+	/** The manipulator component, or the shared settings of a declared manipulator. */
+	TWeakObjectPtr<UManipulatorComponent> Component;
+	/** Actor whose properties the manipulator edits. */
+	TWeakObjectPtr<AActor> Actor;
+	/** Name of the declaring property, none for components. */
+	FName DeclaredName = NAME_None;
+	/** Id selections are remembered by, see UManipulatorComponent::GetManipulatorGuid. */
+	FGuid Guid;
+
+	UManipulatorComponent* GetComponent() const { return Component.Get(); }
+	AActor* GetActor() const { return Actor.Get(); }
+	bool IsValid() const { return ::IsValid(GetComponent()) && ::IsValid(GetActor()); }
+	bool IsDeclared() const { return DeclaredName.IsNone() == false; }
+
+	/** Name the manipulator is known by on its actor, the component name or the declaring property's name. */
+	FName GetName() const;
+
+	/** Same id UManipulatorComponent::GetManipulatorIDForIndex makes for components. */
+	FString GetID(int32 PropertyIndex) const;
+
+	bool operator==(const FManipulatorHandle& Other) const
+	{
+		return Component == Other.Component && Actor == Other.Actor;
+	}
+
+	friend uint32 GetTypeHash(const FManipulatorHandle& Handle)
+	{
+		return HashCombine(GetTypeHash(Handle.Component), GetTypeHash(Handle.Actor));
+	}
+};
+
+/**
+ * Manipulators declared on actor properties, for example
+ *     UPROPERTY(EditAnywhere, meta = (Manipulator, ManipulatorPreset = "/Game/Manipulators/Handle.Handle"))
+ *     FTransform Handle;
+ * Transform, Vector, enum and bool properties are supported, Transform and Vector arrays get one manipulator for every element.
+ * ManipulatorMirror names the partner property, ManipulatorStepSize and ManipulatorDirection (X, Y or Z) set up enums.
+ *
+ * Each class is scanned once and the layout, including one settings object per declared manipulator, is shared by all of its instances.
+ * Nothing is created per actor, the mode draws and edits through handles pairing the shared settings with the actor.
+ */
+class FManipulatorDescriptors
+{
+public:
+	/** Descriptors for a class including its parents, scanned the first time the class is asked for. */
+	static const TArray<FManipulatorDescriptor>& GetClassDescriptors(UClass* Class);
+
+	/** Every manipulator on Actor, its manipulator components followed by its declared manipulators. */
+	static void GetActorManipulators(AActor* Actor, TArray<FManipulatorHandle>& OutManipulators);
+
+	/** The manipulator with the given id, a registered component or a declared manipulator on an actor GetActorManipulators has seen. Returns false if there is none. */
+	static bool FindManipulator(const FGuid& Guid, FManipulatorHandle& OutManipulator);
+
+	/** Forgets the declared manipulators of actors that are gone or no longer selected. */
+	static void Prune();
+
+	/** Forgets every declared manipulator and the scanned classes, releasing their shared settings. */
+	static void Reset();
+};
@@ -0,0 +1,126 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class FManipulatorToolsEditorEdMode;
+
+enum class EManipulatorInputEventType : uint8
+{
+	/** The editor's actor selection changed. */
+	SelectActors,
+	/** A manipulator was clicked. */
+	Click,
+	/** A widget drag started, carries the manipulator selection it started with. */
+	BeginDrag,
+	/** One widget input delta. */
+	Delta,
+	EndDrag
+};
+
+/** A selected manipulator element. */
+struct FManipulatorInputSelection
+{
+	FGuid ManipulatorGuid;
+	int32 PropertyIndex = INDEX_NONE;
+
+	friend FArchive& operator<<(FArchive& Ar, FManipulatorInputSelection& Selection)
+	{
+		return Ar << Selection.ManipulatorGuid << Selection.PropertyIndex;
+	}
+};
+
+/** One input the manipulator mode received, only the fields its type uses are filled in. */
+struct FManipulatorInputEvent
+{
+	EManipulatorInputEventType Type = EManipulatorInputEventType::Click;
+	/** Time since recording started. */
+	double Seconds = 0.0;
+
+	/** Click target and modifiers. */
+	FManipulatorInputSelection Target;
+	bool bControlDown = false;
+	bool bShiftDown = false;
+
+	/** Widget axis and deltas for drags. */
+	int32 Axis = 0;
+	FVector Drag = FVector::ZeroVector;
+	FRotator Rot = FRotator::ZeroRotator;
+	FVector Scale = FVector::ZeroVector;
+
+	/** Manipulator selection for BeginDrag. */
+	TArray<FManipulatorInputSelection> Selection;
+	/** Selected actor paths for SelectActors. */
+	TArray<FString> Actors;
+
+	friend FArchive& operator<<(FArchive& Ar, FManipulatorInputEvent& Event);
+};
+
+/** Manipulator values of an actor when it was first seen by a recording and when the recording stopped. */
+struct FManipulatorInputRecordedActor
+{
+	FString ActorPath;
+	TArray<uint8> InitialPose;
+	TArray<uint8> FinalPose;
+
+	friend FArchive& operator<<(FArchive& Ar, FManipulatorInputRecordedActor& Actor)
+	{
+		return Ar << Actor.ActorPath << Actor.InitialPose << Actor.FinalPose;
+	}
+};
+
+/**
+ * Everything the manipulator mode was asked to do during a session, saved so it can be replayed without a viewport.
+ * Actors are put back to the values they had when the recording first saw them, so replays always start from the same state
+ * and should finish with the exact bytes that were recorded.
+ *
+ * ManipulatorTools.Input.StartRecording and ManipulatorTools.Input.StopRecording [File] record in the editor,
+ * ManipulatorTools.Input.Replay File replays in the editor and the ManipulatorInputReplay commandlet replays headless.
+ */
+class FManipulatorInputRecording
+{
+public:
+	/** Package of the level the recording was made in. */
+	FString MapName;
+	TArray<FManipulatorInputEvent> Events;
+	TArray<FManipulatorInputRecordedActor> RecordedActors;
+
+	/** Adds an actor the first time it is seen, capturing its current values. */
+	void AddActor(AActor* Actor);
+
+	/** Captures the final values of every recorded actor. */
+	void CaptureFinalPoses();
+
+	bool SaveToFile(const FString& Filename);
+	bool LoadFromFile(const FString& Filename);
+};
+
+/** Result of replaying a recording. */
+struct FManipulatorInputReplayResult
+{
+	int32 NumEvents = 0;
+	int32 NumDeltas = 0;
+	double TotalMilliseconds = 0.0;
+	/** Percentiles of the time each delta event took. */
+	double DeltaP50Milliseconds = 0.0;
+	double DeltaP95Milliseconds = 0.0;
+	double DeltaMaxMilliseconds = 0.0;
+	/** Recorded actors that couldn't be found or whose values didn't come out byte for byte the same. */
+	TArray<FString> MissingActors;
+	TArray<FString> MismatchedActors;
+
+	bool Succeeded() const { return MissingActors.Num() == 0 && MismatchedActors.Num() == 0; }
+	FString ToString() const;
+};
+
+class FManipulatorInputReplay
+{
+public:
+	/** Resets the recorded actors, feeds every event into the mode and compares the values it ends on with the recorded ones. */
+	static FManipulatorInputReplayResult Replay(FManipulatorToolsEditorEdMode& Mode, const FManipulatorInputRecording& Recording);
+
+	/** The manipulator mode, activated if it isn't active already. */
+	static FManipulatorToolsEditorEdMode* ActivateManipulatorMode();
+};
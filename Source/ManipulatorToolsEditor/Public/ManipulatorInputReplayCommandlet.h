@@ -0,0 +1,23 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ManipulatorInputReplayCommandlet.generated.h"
+
+/**
+ * Replays a manipulator input recording headless against the level it was recorded in.
+ * Usage: -run=ManipulatorInputReplay -Recording=Path/To/Recording.bin [-Map=/Game/Maps/Map]
+ * Returns 0 when every recorded actor ends on exactly the recorded values.
+ */
+UCLASS()
+class UManipulatorInputReplayCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UManipulatorInputReplayCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,74 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Timed parts of the path from input to the viewport showing the result. */
+enum class EManipulatorLatencyStat : uint8
+{
+	/** Clicking a manipulator until the next render draws the new selection. */
+	ClickToVisible,
+	/** A widget drag that changed something until the next render draws it. */
+	DragToVisible,
+	/** Resolving and writing one dragged property value. */
+	PropertyWrite,
+	/** PostEditChange on an edited object, this is where construction scripts rerun. */
+	PostEditChange,
+	/** Auto keying edited properties in sequencer. */
+	SequencerKey,
+	/** One viewport render of the manipulators. */
+	Render,
+	Count
+};
+
+/**
+ * Rolling timings for the manipulator mode, only recorded while ManipulatorTools.LatencyStats is 1.
+ * Each stat keeps its most recent samples so percentiles follow what the mode is doing now.
+ * ManipulatorTools.LatencyStats.Dump logs p50/p95/p99, ManipulatorTools.LatencyStats.Export [File] writes them to a csv
+ * and ManipulatorTools.LatencyStats.Reset clears them.
+ */
+class FManipulatorLatencyStats
+{
+public:
+	static bool IsEnabled();
+
+	/** Records a sample that started at StartCycles and ends now. */
+	static void AddSample(EManipulatorLatencyStat Stat, uint64 StartCycles);
+
+	/** Starts a stat that ends on the next render, an earlier start that hasn't been rendered yet is kept. */
+	static void BeginUntilRendered(EManipulatorLatencyStat Stat, uint64 StartCycles);
+
+	/** Called once a render has drawn, ends everything started with BeginUntilRendered. */
+	static void EndRendered();
+
+	/** Writes a line per stat to the log. */
+	static void Dump();
+
+	/** Writes the percentiles of every stat to a csv file. Returns false if it couldn't be written. */
+	static bool ExportCsv(const FString& Filename);
+
+	static void Reset();
+};
+
+/** Times the rest of the scope into a stat when stats are on. */
+struct FManipulatorLatencyScope
+{
+	explicit FManipulatorLatencyScope(EManipulatorLatencyStat InStat)
+		: Stat(InStat)
+		, StartCycles(FManipulatorLatencyStats::IsEnabled() ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	~FManipulatorLatencyScope()
+	{
+		if (StartCycles != 0)
+		{
+			FManipulatorLatencyStats::AddSample(Stat, StartCycles);
+		}
+	}
+
+private:
+	EManipulatorLatencyStat Stat;
+	uint64 StartCycles;
+};
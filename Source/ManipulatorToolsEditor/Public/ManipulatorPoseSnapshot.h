@@ -0,0 +1,45 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+struct FManipulatorHandle;
+
+/**
+ * Every manipulator driven value on a set of actors packed into one flat binary blob.
+ * Values are keyed by manipulator identity (component name, property name and array index) rather than by actor,
+ * so a snapshot taken from one actor can be pasted onto any other instance of the same class.
+ */
+class FManipulatorPoseSnapshot
+{
+public:
+	/** Reads every manipulator driven value from the actors. If two actors share a manipulator the first one wins. */
+	static FManipulatorPoseSnapshot Capture(const TArray<AActor*>& Actors);
+
+	/** Wraps previously captured data, returns an empty snapshot if the data isn't a valid snapshot. */
+	static FManipulatorPoseSnapshot FromData(TArray<uint8> InData);
+
+	/** Writes the values onto every actor inside one transaction, each with a property scoped notification where all but the last per actor are interactive. Returns how many values were written. */
+	int32 Apply(const TArray<AActor*>& Actors) const;
+
+	bool IsEmpty() const { return NumValues == 0; }
+	int32 Num() const { return NumValues; }
+
+	/** Raw payload, this is what pose libraries store. */
+	const TArray<uint8>& GetData() const { return Data; }
+
+	/** Stable key for a single manipulated value, stored as is so values can't be mixed up by a hash collision. */
+	static FString MakeKey(const FManipulatorHandle& Manipulator, int32 PropertyIndex);
+
+	/** Calls Visitor for every value the manipulators on Actor drive, including each element of array manipulators. */
+	static void ForEachManipulatorValue(AActor* Actor, TFunctionRef<void(const FManipulatorHandle&, int32)> Visitor);
+
+private:
+	/** Byte offset of every value keyed by manipulator, built when applying. */
+	void BuildOffsetMap(TMap<FString, int32>& OutOffsets) const;
+
+	TArray<uint8> Data;
+	int32 NumValues = 0;
+};
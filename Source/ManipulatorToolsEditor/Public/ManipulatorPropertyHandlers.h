@@ -0,0 +1,156 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ManipulatorComponent.h"
+#include "Misc/FrameNumber.h"
+#include "Channels/MovieSceneFloatChannel.h"
+
+class UProperty;
+class FEditPropertyChain;
+struct FMovieSceneChannelProxy;
+
+/** Values of one property gathered by a sequencer bake, one entry per frame, and the keys built from them. */
+struct FManipulatorBakeValues
+{
+	/** Gathered on the game thread. Transforms hold vectors too, bytes hold bools too. */
+	TArray<FTransform> Transforms;
+	TArray<uint8> Bytes;
+
+	/** Built from the gathered values, one array per float channel in the order the section exposes them. */
+	TArray<TArray<FMovieSceneFloatValue>> FloatKeys;
+};
+
+/**
+ * Compile time description of one manipulated property type.
+ * Each specialisation says how the value is stored, how it shows up on the widget, how a widget drag turns back into a value, what track keys it and how a bake keys that track.
+ * Adding a type means adding it to EManipulatorPropertyType, specialising these traits and adding it to the handler table.
+ */
+template<EManipulatorPropertyType PropertyType>
+struct TManipulatorPropertyTraits;
+
+template<>
+struct TManipulatorPropertyTraits<EManipulatorPropertyType::MT_TRANSFORM>
+{
+	typedef FTransform ValueType;
+	static const bool bUsesWidget = true;
+	static const bool bHasFloatChannels = true;
+
+	static FTransform ToTransform(const FTransform& Value, const FManipulatorSettingsMainProperty& Settings) { return Value; }
+	static FVector GetWidgetOffset(const FTransform& Value, const FManipulatorSettingsMainProperty& Settings) { return FVector::ZeroVector; }
+	static void ApplyTransform(FTransform& Value, const FTransform& NewTransform, const FManipulatorSettingsMainProperty& Settings) { Value = NewTransform; }
+	static void Serialize(FArchive& Ar, FTransform& Value) { Ar << Value; }
+	static UClass* GetTrackClass();
+
+	static void GatherBakeValue(const FTransform& Value, FManipulatorBakeValues& Values) { Values.Transforms.Add(Value); }
+	/** Location, rotation and scale channels. */
+	static void BuildBakeKeys(FManipulatorBakeValues& Values);
+	static void WriteBakeKeys(FMovieSceneChannelProxy& ChannelProxy, const TArray<FFrameNumber>& Times, const FManipulatorBakeValues& Values);
+};
+
+template<>
+struct TManipulatorPropertyTraits<EManipulatorPropertyType::MT_VECTOR>
+{
+	typedef FVector ValueType;
+	static const bool bUsesWidget = true;
+	static const bool bHasFloatChannels = true;
+
+	static FTransform ToTransform(const FVector& Value, const FManipulatorSettingsMainProperty& Settings) { return FTransform(Value); }
+	static FVector GetWidgetOffset(const FVector& Value, const FManipulatorSettingsMainProperty& Settings) { return FVector::ZeroVector; }
+	static void ApplyTransform(FVector& Value, const FTransform& NewTransform, const FManipulatorSettingsMainProperty& Settings) { Value = NewTransform.GetLocation(); }
+	static void Serialize(FArchive& Ar, FVector& Value) { Ar << Value; }
+	static UClass* GetTrackClass();
+
+	static void GatherBakeValue(const FVector& Value, FManipulatorBakeValues& Values) { Values.Transforms.Add(FTransform(Value)); }
+	/** Location channels only. */
+	static void BuildBakeKeys(FManipulatorBakeValues& Values);
+	static void WriteBakeKeys(FMovieSceneChannelProxy& ChannelProxy, const TArray<FFrameNumber>& Times, const FManipulatorBakeValues& Values);
+};
+
+template<>
+struct TManipulatorPropertyTraits<EManipulatorPropertyType::MT_ENUM>
+{
+	typedef uint8 ValueType;
+	static const bool bUsesWidget = true;
+	static const bool bHasFloatChannels = false;
+
+	/** Enums don't move the widget through the property transform, they step it along their direction instead. */
+	static FTransform ToTransform(const uint8& Value, const FManipulatorSettingsMainProperty& Settings) { return FTransform::Identity; }
+	static FVector GetWidgetOffset(const uint8& Value, const FManipulatorSettingsMainProperty& Settings);
+	/** Snaps the dragged distance along the enum direction to whole steps and adds them to the value. */
+	static void ApplyTransform(uint8& Value, const FTransform& NewTransform, const FManipulatorSettingsMainProperty& Settings);
+	static void Serialize(FArchive& Ar, uint8& Value) { Ar << Value; }
+	static UClass* GetTrackClass();
+
+	static void GatherBakeValue(const uint8& Value, FManipulatorBakeValues& Values) { Values.Bytes.Add(Value); }
+	/** Byte channels are keyed straight from the gathered values. */
+	static void BuildBakeKeys(FManipulatorBakeValues& Values) {}
+	static void WriteBakeKeys(FMovieSceneChannelProxy& ChannelProxy, const TArray<FFrameNumber>& Times, const FManipulatorBakeValues& Values);
+};
+
+template<>
+struct TManipulatorPropertyTraits<EManipulatorPropertyType::MT_BOOL>
+{
+	typedef bool ValueType;
+	static const bool bUsesWidget = false;
+	static const bool bHasFloatChannels = false;
+
+	/** Bools are toggled by clicking, they have no widget to drag. */
+	static FTransform ToTransform(const bool& Value, const FManipulatorSettingsMainProperty& Settings) { return FTransform::Identity; }
+	static FVector GetWidgetOffset(const bool& Value, const FManipulatorSettingsMainProperty& Settings) { return FVector::ZeroVector; }
+	static void ApplyTransform(bool& Value, const FTransform& NewTransform, const FManipulatorSettingsMainProperty& Settings) {}
+	static void Serialize(FArchive& Ar, bool& Value)
+	{
+		uint8 ByteValue = Value ? 1 : 0;
+		Ar << ByteValue;
+		Value = ByteValue != 0;
+	}
+	static UClass* GetTrackClass();
+
+	static void GatherBakeValue(const bool& Value, FManipulatorBakeValues& Values) { Values.Bytes.Add(Value ? 1 : 0); }
+	static void BuildBakeKeys(FManipulatorBakeValues& Values) {}
+	static void WriteBakeKeys(FMovieSceneChannelProxy& ChannelProxy, const TArray<FFrameNumber>& Times, const FManipulatorBakeValues& Values);
+};
+
+/** The traits of one property type flattened into a function table so callers dispatch once per manipulator instead of switching on every operation. */
+struct FManipulatorPropertyHandler
+{
+	EManipulatorPropertyType Type;
+	bool bUsesWidget;
+	bool bHasFloatChannels;
+
+	/** Finds the value inside Object, optionally recording the property chain for change notifications. */
+	void* (*Resolve)(UObject* Object, const FString& PropertyName, int32 PropertyIndex, UProperty*& OutProperty, FEditPropertyChain* OutPropertyChain);
+
+	/** Reads the value as the transform the widget is placed with, plus any extra widget offset. Returns false if the property can't be found. */
+	bool (*Read)(UObject* Object, const FManipulatorSettingsMainProperty& Settings, int32 PropertyIndex, FTransform& OutPropertyTransform, FVector& OutWidgetOffset);
+
+	/** Writes the value a dragged property transform represents into a resolved value. */
+	void (*ApplyTransform)(void* ValuePtr, const FTransform& NewTransform, const FManipulatorSettingsMainProperty& Settings);
+
+	/** Reads or writes a resolved value, Skip reads past one without a destination. */
+	void (*Serialize)(FArchive& Ar, void* ValuePtr);
+	void (*Skip)(FArchive& Ar);
+
+	/** Sequencer track class that keys this type. */
+	UClass* (*GetTrackClass)();
+
+	/** Reserves room for NumFrames gathered values. */
+	void (*ReserveBakeValues)(FManipulatorBakeValues& Values, int32 NumFrames);
+
+	/** Adds the current value of the property to Values, the type's default if it can't be found. Game thread only. */
+	void (*GatherBakeValue)(UObject* Object, const FString& PropertyName, int32 PropertyIndex, FManipulatorBakeValues& Values);
+
+	/** Turns gathered values into channel keys. Only touches Values so it is safe to run on any thread. */
+	void (*BuildBakeKeys)(FManipulatorBakeValues& Values);
+
+	/** Writes one key per time into the section's channels, replacing keys between the first and last time. */
+	void (*WriteBakeKeys)(FMovieSceneChannelProxy& ChannelProxy, const TArray<FFrameNumber>& Times, const FManipulatorBakeValues& Values);
+};
+
+/** Handler for a property type, the table is indexed by the type so this is a single lookup. */
+const FManipulatorPropertyHandler& GetManipulatorPropertyHandler(EManipulatorPropertyType Type);
+
+/** Same as GetManipulatorPropertyHandler for a type read back from serialized data, returns null if it isn't a known type. */
+const FManipulatorPropertyHandler* FindManipulatorPropertyHandler(uint8 Type);
@@ -0,0 +1,21 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/FrameNumber.h"
+
+class AActor;
+class ISequencer;
+
+/**
+ * Bakes every manipulator driven property on a set of actors into sequencer keys.
+ * The sequence is evaluated once per display frame on the game thread and values are gathered into flat buffers,
+ * turning those buffers into channel keys happens in parallel per track and each channel is then written in one go.
+ */
+class FManipulatorSequencerBake
+{
+public:
+	/** Keys every display frame in Range, replacing keys inside the range and leaving keys outside it alone. Returns how many tracks were baked, 0 if cancelled. */
+	static int32 Bake(TSharedRef<ISequencer> Sequencer, const TArray<AActor*>& Actors, TRange<FFrameNumber> Range);
+};
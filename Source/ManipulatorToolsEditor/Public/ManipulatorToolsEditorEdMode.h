@@ -4,13 +4,25 @@
 
 #include "CoreMinimal.h"
 #include "EdMode.h"
+#include "DynamicMeshBuilder.h"
 #include "ISequencer.h"
 #include "ISequencerModule.h"
 #include "ManipulatorComponent.h"
+#include "ManipulatorDescriptors.h"
+#include "ManipulatorPoseSnapshot.h"
+#include "ManipulatorPropertyHandlers.h"
+#include "ManipulatorInputRecording.h"
+
+class FScopedTransaction;
+class UManipulatorPoseLibrary;
+class UMovieScene;
+class UMovieSceneTrack;
 
 struct FManipulatorData
 {
 	FString ID = FString();
+	/** Stable id of the manipulator, used to find it again after its component has been recreated. */
+	FGuid ManipulatorGuid;
 	FString PropertyName = FString();
 	int PropertyIndex = INDEX_NONE;
 	FString ComponentName = FString();
@@ -20,19 +32,141 @@ struct FManipulatorData
 	uint32 ActorUniqueID;
 };
 
+/** Identifies a selected manipulator element by the same guid and index selections are compared with. */
+struct FManipulatorSelectionKey
+{
+	FGuid ManipulatorGuid;
+	int32 PropertyIndex = INDEX_NONE;
+
+	FManipulatorSelectionKey() {}
+	explicit FManipulatorSelectionKey(const FManipulatorData& ManipulatorData) : ManipulatorGuid(ManipulatorData.ManipulatorGuid), PropertyIndex(ManipulatorData.PropertyIndex) {}
+
+	bool operator==(const FManipulatorSelectionKey& Other) const
+	{
+		return ManipulatorGuid == Other.ManipulatorGuid && PropertyIndex == Other.PropertyIndex;
+	}
+
+	friend uint32 GetTypeHash(const FManipulatorSelectionKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.ManipulatorGuid), GetTypeHash(Key.PropertyIndex));
+	}
+};
+
+/** A single property write worked out during a drag, applied once every selected manipulator has been handled. */
+struct FManipulatorEdit
+{
+	UObject* Object = nullptr;
+	FManipulatorSettingsMainProperty Property;
+	int32 PropertyIndex = INDEX_NONE;
+	/** Dragged property transform, turned into the stored value by the property type's handler. */
+	FTransform Value = FTransform::Identity;
+};
+
+/** An auto-key request held back until the end of the frame. */
+struct FPendingManipulatorKey
+{
+	TWeakObjectPtr<UObject> Object;
+	UProperty* Property = nullptr;
+
+	bool operator==(const FPendingManipulatorKey& Other) const
+	{
+		return Object == Other.Object && Property == Other.Property;
+	}
+};
+
+/** A property auto-keyed during the current drag and the frames the drag added keys on, only those keys are ever reduced. */
+struct FDragKeyedProperty
+{
+	FPendingManipulatorKey Key;
+	TArray<FFrameNumber> CreatedFrames;
+};
+
+/** One line of a manipulator's wire shapes, already in world space at a zoom multiplier of 1. */
+struct FManipulatorDrawLine
+{
+	FVector Start;
+	FVector End;
+	FLinearColor Color;
+	float Thickness;
+	/** Lines of shapes sized by the zoom offset are scaled about Pivot by each view's multiplier when they're drawn. */
+	bool bScaleWithZoom;
+	FVector Pivot;
+};
+
+/** Identifies the drawing of one manipulator element. */
+struct FManipulatorDrawCacheKey
+{
+	FManipulatorHandle Manipulator;
+	int32 PropertyIndex = INDEX_NONE;
+
+	bool operator==(const FManipulatorDrawCacheKey& Other) const
+	{
+		return Manipulator == Other.Manipulator && PropertyIndex == Other.PropertyIndex;
+	}
+
+	friend uint32 GetTypeHash(const FManipulatorDrawCacheKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.Manipulator), GetTypeHash(Key.PropertyIndex));
+	}
+};
+
+/** Wire lines generated for a manipulator element and everything they were generated from, replayed until one of the inputs changes. Nothing in here depends on the view so every viewport shares it. */
+struct FManipulatorDrawCache
+{
+	uint32 SettingsVersion = MAX_uint32;
+	FTransform WidgetTransform = FTransform::Identity;
+	FLinearColor DrawColor = FLinearColor::Transparent;
+	TArray<FManipulatorDrawLine> Lines;
+};
+
+/** Plane geometry for one tessellation and UV range, in the same -1 to 1 space DrawPlane10x10 uses. */
+struct FManipulatorPlaneMeshKey
+{
+	int32 NumTiles = 1;
+	FVector2D UVRange = FVector2D(0.0f, 1.0f);
+
+	bool operator==(const FManipulatorPlaneMeshKey& Other) const
+	{
+		return NumTiles == Other.NumTiles && UVRange == Other.UVRange;
+	}
+
+	friend uint32 GetTypeHash(const FManipulatorPlaneMeshKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.NumTiles), GetTypeHash(Key.UVRange));
+	}
+};
+
+struct FManipulatorPlaneMesh
+{
+	TArray<FDynamicMeshVertex> Vertices;
+	TArray<uint32> Indices;
+};
+
+/** A manipulator element worked out for the current frame, shared by every viewport that draws it. */
+struct FManipulatorFrameElement
+{
+	FManipulatorHandle Manipulator;
+	int32 PropertyIndex = INDEX_NONE;
+	FTransform WidgetTransform = FTransform::Identity;
+	FLinearColor DrawColor = FLinearColor::White;
+};
+
 /** Hit proxy used for editable properties */
 struct HManipulatorProxy : public HHitProxy
 {
 	DECLARE_HIT_PROXY();
 
-	/** Component this hit proxy will talk to. */
-	UManipulatorComponent* ManipulatorComponent;
+	/** Manipulator this hit proxy will talk to. */
+	FManipulatorHandle Manipulator;
+
+	/** Array element this hit proxy was drawn for. */
+	int32 PropertyIndex;
 
 	/** This property is a transform */
 	bool	bPropertyIsTransform;
 
 	// Constructor
-	HManipulatorProxy(UManipulatorComponent* ManipulatorComponent) : HHitProxy(HPP_Foreground), ManipulatorComponent(ManipulatorComponent)
+	HManipulatorProxy(const FManipulatorHandle& Manipulator, int32 PropertyIndex) : HHitProxy(HPP_Foreground), Manipulator(Manipulator), PropertyIndex(PropertyIndex)
 	{
 	}
 
@@ -43,94 +177,157 @@ struct HManipulatorProxy : public HHitProxy
 	}
 };
 
-IMPLEMENT_HIT_PROXY(HManipulatorProxy, HHitProxy);
-
 // A bunch of functions that EdMode Uses to get properties by name that I don't have access to because 
 // EdMode is dumb and doesn't put it in the header so I followed their example and copied it.
 namespace
 {
 	/**
-	 * Returns a reference to the named property value data in the given container.
+	 * Walks a dotted property path down to the struct and container that own its last segment.
 	 */
-	template<typename T>
-	T* GetPropertyValuePtrByName(const UStruct* InStruct, void* InContainer, FString PropertyName, int32 ArrayIndex, UProperty*& OutProperty)
+	inline bool ResolvePropertyContainerByName(const UStruct*& InOutStruct, void*& InOutContainer, FString& InOutPropertyName, FEditPropertyChain* OutPropertyChain = NULL)
 	{
-		T* ValuePtr = NULL;
-
-		// Extract the vector ptr recursively using the property name
-		int32 DelimPos = PropertyName.Find(TEXT("."));
-		if (DelimPos != INDEX_NONE)
+		// Extract the container ptr recursively using the property name
+		int32 DelimPos = InOutPropertyName.Find(TEXT("."));
+		while (DelimPos != INDEX_NONE)
 		{
 			// Parse the property name and (optional) array index
 			int32 SubArrayIndex = 0;
-			FString NameToken = PropertyName.Left(DelimPos);
+			FString NameToken = InOutPropertyName.Left(DelimPos);
 			int32 ArrayPos = NameToken.Find(TEXT("["));
 			if (ArrayPos != INDEX_NONE)
 			{
 				FString IndexToken = NameToken.RightChop(ArrayPos + 1).LeftChop(1);
 				SubArrayIndex = FCString::Atoi(*IndexToken);
 
-				NameToken = PropertyName.Left(ArrayPos);
+				NameToken = InOutPropertyName.Left(ArrayPos);
 			}
 
 			// Obtain the property info from the given structure definition
-			UProperty* CurrentProp = FindField<UProperty>(InStruct, FName(*NameToken));
+			UProperty* CurrentProp = FindField<UProperty>(InOutStruct, FName(*NameToken));
+			if (OutPropertyChain != NULL && CurrentProp != NULL)
+			{
+				OutPropertyChain->AddTail(CurrentProp);
+			}
 			// Check first to see if this is a simple structure (i.e. not an array of structures)
 			UStructProperty* StructProp = Cast<UStructProperty>(CurrentProp);
 			if (StructProp != NULL)
 			{
-				// Recursively call back into this function with the structure property and container value
-				ValuePtr = GetPropertyValuePtrByName<T>(StructProp->Struct, StructProp->ContainerPtrToValuePtr<void>(InContainer), PropertyName.RightChop(DelimPos + 1), ArrayIndex, OutProperty);
+				InOutStruct = StructProp->Struct;
+				InOutContainer = StructProp->ContainerPtrToValuePtr<void>(InOutContainer);
 			}
 			else
 			{
-				// Check to see if this is an array
+				// Check to see if this is an array of structures
 				UArrayProperty* ArrayProp = Cast<UArrayProperty>(CurrentProp);
-				if (ArrayProp != NULL)
+				StructProp = ArrayProp != NULL ? Cast<UStructProperty>(ArrayProp->Inner) : NULL;
+				if (StructProp == NULL)
+				{
+					return false;
+				}
+
+				FScriptArrayHelper_InContainer ArrayHelper(ArrayProp, InOutContainer);
+				if (!ArrayHelper.IsValidIndex(SubArrayIndex))
 				{
-					// It is an array, now check to see if this is an array of structures
-					StructProp = Cast<UStructProperty>(ArrayProp->Inner);
-					if (StructProp != NULL)
-					{
-						FScriptArrayHelper_InContainer ArrayHelper(ArrayProp, InContainer);
-						if (ArrayHelper.IsValidIndex(SubArrayIndex))
-						{
-							// Recursively call back into this function with the array element and container value
-							ValuePtr = GetPropertyValuePtrByName<T>(StructProp->Struct, ArrayHelper.GetRawPtr(SubArrayIndex), PropertyName.RightChop(DelimPos + 1), ArrayIndex, OutProperty);
-						}
-					}
+					return false;
 				}
+				InOutStruct = StructProp->Struct;
+				InOutContainer = ArrayHelper.GetRawPtr(SubArrayIndex);
 			}
+
+			InOutPropertyName = InOutPropertyName.RightChop(DelimPos + 1);
+			DelimPos = InOutPropertyName.Find(TEXT("."));
 		}
-		else
+		return true;
+	}
+
+	/**
+	 * Returns a reference to the named property value data in the given container.
+	 */
+	template<typename T>
+	T* GetPropertyValuePtrByName(const UStruct* InStruct, void* InContainer, FString PropertyName, int32 ArrayIndex, UProperty*& OutProperty, FEditPropertyChain* OutPropertyChain = NULL)
+	{
+		T* ValuePtr = NULL;
+		if (!ResolvePropertyContainerByName(InStruct, InContainer, PropertyName, OutPropertyChain))
 		{
-			UProperty* Prop = FindField<UProperty>(InStruct, FName(*PropertyName));
-			if (Prop != NULL)
+			return ValuePtr;
+		}
+
+		UProperty* Prop = FindField<UProperty>(InStruct, FName(*PropertyName));
+		if (Prop != NULL)
+		{
+			if (UArrayProperty* ArrayProp = Cast<UArrayProperty>(Prop))
 			{
-				if (UArrayProperty* ArrayProp = Cast<UArrayProperty>(Prop))
-				{
-					check(ArrayIndex != INDEX_NONE);
-
-					// Property is an array property, so make sure we have a valid index specified
-					FScriptArrayHelper_InContainer ArrayHelper(ArrayProp, InContainer);
-					if (ArrayHelper.IsValidIndex(ArrayIndex))
-					{
-						ValuePtr = (T*)ArrayHelper.GetRawPtr(ArrayIndex);
-					}
-				}
-				else
+				check(ArrayIndex != INDEX_NONE);
+
+				// Property is an array property, so make sure we have a valid index specified
+				FScriptArrayHelper_InContainer ArrayHelper(ArrayProp, InContainer);
+				if (ArrayHelper.IsValidIndex(ArrayIndex))
 				{
-					// Property is a vector property, so access directly
-					ValuePtr = Prop->ContainerPtrToValuePtr<T>(InContainer);
+					ValuePtr = (T*)ArrayHelper.GetRawPtr(ArrayIndex);
 				}
+			}
+			else
+			{
+				// Property is a vector property, so access directly
+				ValuePtr = Prop->ContainerPtrToValuePtr<T>(InContainer);
+			}
 
-				OutProperty = Prop;
+			OutProperty = Prop;
+			if (OutPropertyChain != NULL)
+			{
+				OutPropertyChain->AddTail(Prop);
 			}
 		}
 
 		return ValuePtr;
 	}
 
+	/**
+	 * Copies every element of the named array property in one pass. Returns false if the property isn't an array of T.
+	 */
+	template<typename T>
+	bool GetPropertyArrayValuesByName(UObject* Object, FString PropertyName, TArray<T>& OutValues)
+	{
+		const UStruct* Struct = Object->GetClass();
+		void* Container = Object;
+		if (!ResolvePropertyContainerByName(Struct, Container, PropertyName))
+		{
+			return false;
+		}
+
+		UArrayProperty* ArrayProp = FindField<UArrayProperty>(Struct, FName(*PropertyName));
+		if (ArrayProp == NULL || ArrayProp->Inner->ElementSize != sizeof(T))
+		{
+			return false;
+		}
+
+		FScriptArrayHelper_InContainer ArrayHelper(ArrayProp, Container);
+		OutValues.Reset(ArrayHelper.Num());
+		for (int32 i = 0; i < ArrayHelper.Num(); i++)
+		{
+			OutValues.Add(*(T*)ArrayHelper.GetRawPtr(i));
+		}
+		return true;
+	}
+
+	/**
+	 * Returns the number of elements in the named array property, or INDEX_NONE if it isn't an array.
+	 */
+	inline int32 GetPropertyArrayNumByName(UObject* Object, FString PropertyName)
+	{
+		const UStruct* Struct = Object->GetClass();
+		void* Container = Object;
+		if (ResolvePropertyContainerByName(Struct, Container, PropertyName))
+		{
+			if (UArrayProperty* ArrayProp = FindField<UArrayProperty>(Struct, FName(*PropertyName)))
+			{
+				FScriptArrayHelper_InContainer ArrayHelper(ArrayProp, Container);
+				return ArrayHelper.Num();
+			}
+		}
+		return INDEX_NONE;
+	}
+
 	/**
 	 * Returns the value of the property with the given name in the given Actor instance.
 	 */
@@ -178,6 +375,8 @@ public:
 	virtual bool HandleClick(FEditorViewportClient* InViewportClient, HHitProxy *HitProxy, const FViewportClick &Click) override;
 	virtual FVector GetWidgetLocation() const override;
 	virtual bool InputDelta(FEditorViewportClient* InViewportClient, FViewport* InViewport, FVector& InDrag, FRotator& InRot, FVector& InScale) override;
+	virtual bool StartTracking(FEditorViewportClient* InViewportClient, FViewport* InViewport) override;
+	virtual bool EndTracking(FEditorViewportClient* InViewportClient, FViewport* InViewport) override;
 	virtual bool AllowWidgetMove() override;
 	virtual bool GetCustomDrawingCoordinateSystem(FMatrix& InMatrix, void* InData);
 	virtual void ActorSelectionChangeNotify() override;
@@ -189,6 +388,15 @@ public:
 	/** Sequencer */
 	void SetSequencer(TWeakPtr<ISequencer> InSequencer);
 	void OnSequencerTrackSelectionChanged(TArray<UMovieSceneTrack*> InTracks);
+	/** Keys every manipulated property on the selected actors across the sequencer selection range, or the playback range if nothing is selected. */
+	void BakeSelectedManipulatorsToSequencer();
+	bool CanBakeToSequencer() const;
+
+	/** Key reduction run on the keys a drag added once it is released, useful when dragging while the sequence plays. Keys that were there before the drag are kept. */
+	void UpdateReduceKeysOnRelease(bool bNewReduceKeysOnRelease);
+	bool GetReduceKeysOnRelease() const;
+	void UpdateKeyReductionTolerance(float NewKeyReductionTolerance);
+	float GetKeyReductionTolerance() const;
 
 	/** Selection Locking for Actors */
 	void UpdateIsActorSelectionLocked(bool bNewIsActorSelectionLocked);
@@ -197,6 +405,33 @@ public:
 	void UpdateUseSafeDeSelect(bool bNewUseSafeDeSelect);
 	bool GetUseSafeDeSelect() const;
 
+	/** Mirrors drags onto each manipulator's left/right partner. */
+	void UpdateUseMirrorEditing(bool bNewUseMirrorEditing);
+	bool GetUseMirrorEditing() const;
+
+	/** Pose clipboard for the selected actors */
+	void CopyManipulatorPose();
+	void PasteManipulatorPose();
+	bool HasCopiedManipulatorPose() const;
+
+	/** Pose libraries, only the values for PoseIndex are loaded. */
+	void ApplyLibraryPose(UManipulatorPoseLibrary* PoseLibrary, int32 PoseIndex);
+	void SaveLibraryPose(UManipulatorPoseLibrary* PoseLibrary, FName PoseName);
+
+	/** Viewport free cores of HandleClick, StartTracking, InputDelta and EndTracking, also used to replay recorded input. */
+	void ClickManipulator(const FManipulatorHandle& Manipulator, int32 PropertyIndex, bool bControlDown, bool bShiftDown);
+	bool BeginManipulatorDrag(EAxisList::Type Axis);
+	bool ApplyManipulatorInputDelta(EAxisList::Type Axis, const FVector& InDrag, const FRotator& InRot, const FVector& InScale);
+	bool EndManipulatorDrag();
+
+	/** Input recording, see FManipulatorInputRecording. Stopping hands the recording over, returns false if nothing was being recorded. */
+	void StartInputRecording();
+	bool StopInputRecording(FManipulatorInputRecording& OutRecording);
+	bool IsRecordingInput() const { return InputRecording.IsValid(); }
+
+	/** Feeds a recorded event back in and settles the selection the way a rendered frame would. */
+	void ReplayInputEvent(const FManipulatorInputEvent& Event);
+
 	/** EditedPropertyName Already Exists in EdMode */
 	FString EditedManipulatorPropertyName = "";
 	FString EditedComponentName = "";
@@ -206,41 +441,110 @@ private:
 	/** Data */
 	bool bIsActorSelectionLocked = false;
 	bool bUseSafeDeSelect = false;
+	bool bUseMirrorEditing = false;
 	TArray<FManipulatorData*> SelectedManipulators;
 	TArray<FManipulatorData*> NewSelectedManipulators;
+
+	/** Open for the length of a widget drag so the whole gesture is a single undo step. */
+	TUniquePtr<FScopedTransaction> DragTransaction;
+	bool bDragChangedProperties = false;
+
+	/** Last pose copied with CopyManipulatorPose. */
+	FManipulatorPoseSnapshot CopiedPose;
 	//TArray<FString> SelectedManipulators;
 
 	/** ManipulatorComponents */
-	virtual bool GetSelectedManipulatorComponent(FManipulatorData* ManipulatorData, UManipulatorComponent*& OutComponent) const;
-	FTransform GetManipulatorTransformWithOffsets(UManipulatorComponent* ManipulatorComponent) const;
-	FTransform GetManipulatorTransformWithOffsets(UManipulatorComponent* ManipulatorComponent, FTransform& WidgetTransformNoPropertyOffset) const;
+	virtual bool GetSelectedManipulator(FManipulatorData* ManipulatorData, FManipulatorHandle& OutManipulator) const;
+	FTransform GetManipulatorTransformWithOffsets(const FManipulatorHandle& Manipulator, int32 PropertyIndex) const;
+	/** AttachedSocketTransform can be passed in when the socket has already been evaluated, otherwise it is looked up on the component. */
+	FTransform GetManipulatorTransformWithOffsets(const FManipulatorHandle& Manipulator, int32 PropertyIndex, FTransform& WidgetTransformNoPropertyOffset, const FTransform* AttachedSocketTransform = nullptr) const;
+	/** Widget transforms for every element of an array manipulator, evaluated in one pass. */
+	void GetManipulatorElementTransforms(const FManipulatorHandle& Manipulator, TArray<FTransform>& OutWidgetTransforms, const FTransform* AttachedSocketTransform = nullptr) const;
+	void DrawManipulator(const FSceneView* View, FPrimitiveDrawInterface* PDI, const FManipulatorHandle& Manipulator, int32 PropertyIndex, const FTransform& WidgetTransform, const FLinearColor& DrawColor);
+	/** Syncs selection and evaluates every visible manipulator, only does the work once per engine frame however many viewports render. */
+	void UpdateManipulatorFrame();
+	/** Applies the select and deselect requests manipulators have queued since the last tick. */
+	void HandleSelectionRequests();
+	/** Makes the next render re-evaluate, used when selection or values change mid-frame. */
+	void InvalidateManipulatorFrame();
+	TArray<FManipulatorFrameElement> ManipulatorFrameElements;
+	uint64 ManipulatorFrameNumber = MAX_uint64;
+
+	/** Regenerates the wire lines of a manipulator element into Cache. */
+	void BuildManipulatorLines(UManipulatorComponent* ManipulatorComponent, const FTransform& WidgetTransform, const FLinearColor& DrawColor, FManipulatorDrawCache& Cache) const;
+	/** Cached wire lines per manipulator element, planes aren't cached and are drawn every frame. */
+	TMap<FManipulatorDrawCacheKey, FManipulatorDrawCache> DrawCache;
+	/** Plane geometry is the same for every plane with the same tessellation and UV range, only the transform changes per draw. */
+	TMap<FManipulatorPlaneMeshKey, FManipulatorPlaneMesh> PlaneMeshes;
+	const FManipulatorPlaneMesh& GetPlaneMesh(int32 NumTiles, const FVector2D& UVRange);
 	UManipulatorComponent* FindManipulatorComponentInActor(FString PropertyName, FString ActorName);
-	bool GetBoolPropertyValueFromManipulator(UManipulatorComponent* ManipulatorComponent);
-	void ToggleBoolPropertyValueFromManipulator(UManipulatorComponent* ManipulatorComponent);
-	UObject* GetObjectToDisplayWidgetsFromManipulator(UManipulatorComponent* ManipulatorComponent) const;
-	uint8 HandleEnumPropertyInputDelta(UManipulatorComponent* ManipulatorComponent, FTransform LocalTM, uint8 EnumInput);
+	bool GetBoolPropertyValueFromManipulator(const FManipulatorHandle& Manipulator);
+	void ToggleBoolPropertyValueFromManipulator(const FManipulatorHandle& Manipulator);
+	UObject* GetObjectToDisplayWidgetsFromManipulator(const FManipulatorHandle& Manipulator) const;
 
-	/** Combines Transforms of the shapes together with an option to rotate the scale vector.*/
-	FTransform HandleFinalShapeTransforms(FTransform ShapeTransform, FTransform OverallScale, FTransform WidgetTransform, bool RotateScale = false);
+	/** Puts a baked shape transform on top of the widget transform with an option to rotate the scale vector.*/
+	FTransform HandleFinalShapeTransform(const FTransform& ShapeTransform, FTransform WidgetTransform, bool RotateScale = false) const;
 	FTransform FlipTransformOnX(FTransform Transform, bool FlipXVector, bool FlipYRotation, bool FlipXScale) const;
 
 	/** Proxies */
 	TArray<HManipulatorProxy*> HitProxies;
-	void AddNewSelectedManipulator(UManipulatorComponent* ManipulatorComponent);
-	void ToggleSelectedManipulator(UManipulatorComponent* ManipulatorComponent);
-	void RemoveSelectedManipulator(UManipulatorComponent* ManipulatorComponent);
-	bool IsManipulatorSelected(UManipulatorComponent* ManipulatorComponent);
+	void AddNewSelectedManipulator(const FManipulatorHandle& Manipulator, int32 PropertyIndex);
+	void ToggleSelectedManipulator(const FManipulatorHandle& Manipulator, int32 PropertyIndex);
+	void RemoveSelectedManipulator(const FManipulatorHandle& Manipulator, int32 PropertyIndex);
+	bool IsManipulatorSelected(const FManipulatorHandle& Manipulator, int32 PropertyIndex);
 	void FindAndAddNewManipulatorSelection(FString PropertyName, FString ActorSequencerName);
 
-	FManipulatorData* GetManipulatorData(UManipulatorComponent* ManipulatorComponent);
 	void ClearManipulatorSelection();
 
 	/** Weak pointer to the last sequencer that was opened */
 	TWeakPtr<ISequencer> WeakSequencer;
 	void SequencerUpdateTrackSelection();
 	bool AllowTrackSelectionUpdate = false;
+	/** Track of each selected manipulator, as last pushed to or read from the sequencer. */
+	TMap<FManipulatorSelectionKey, TWeakObjectPtr<UMovieSceneTrack>> SelectedManipulatorTracks;
+	/** True while the mode changes the sequencer's track selection so the change doesn't come back as a new manipulator selection. */
+	bool bUpdatingSequencerSelection = false;
+	UMovieSceneTrack* FindManipulatorTrack(UMovieScene* Scene, const TMultiMap<FString, FGuid>& BindingGuids, const FManipulatorData* ManipulatorData) const;
+	/** Whether a sequencer selection change is just the selection the mode last pushed. */
+	bool IsSequencerSelectionEcho(const TArray<UMovieSceneTrack*>& InTracks) const;
 	int32 DeSelectCounter = 0;
 	void ResetDeSelectCounter();
 	void ReduceDeSelectCounter();
 	void SequencerKeyProperty(UObject* ObjectToKey, UProperty* propertyToUse);
+	void SequencerKeyPropertyNow(UObject* ObjectToKey, UProperty* propertyToUse);
+
+	/** Auto-keys made while dragging are coalesced to one per property per frame. */
+	TArray<FPendingManipulatorKey> PendingKeys;
+	void FlushPendingKeys();
+
+	/** Properties keyed during the current drag and the frames they were keyed on. */
+	TArray<FDragKeyedProperty> DragKeyedProperties;
+	/** Drops keys the drag added where the curve through the keys around them is already within KeyReductionTolerance. */
+	void ReduceDragKeys();
+	bool bReduceKeysOnRelease = false;
+	float KeyReductionTolerance = 0.01f;
+
+	/** Resolves the named property through the type's handler and, when given a chain, sends a PreEditChange scoped to just that property. Returns the value to write or NULL if the property couldn't be found. */
+	void* BeginManipulatorPropertyEdit(const FManipulatorPropertyHandler& PropertyHandler, UObject* Object, const FString& PropertyName, int32 PropertyIndex, UProperty*& OutProperty, FEditPropertyChain* OutPropertyChain);
+	/** Matching PostEditChange for BeginManipulatorPropertyEdit. */
+	void PostEditManipulatorProperty(UObject* Object, FEditPropertyChain& PropertyChain, EPropertyChangeType::Type ChangeType = EPropertyChangeType::ValueSet);
+
+	/** Writes queued edits, each with its own property scoped notification but only one construction script rerun per object. Returns true if anything was written. */
+	bool ApplyManipulatorEdits(TArray<FManipulatorEdit>& Edits);
+	UProperty* WriteManipulatorEdit(const FManipulatorEdit& Edit, FEditPropertyChain* PropertyChain);
+
+	/** Input being recorded, null when not recording. */
+	TUniquePtr<FManipulatorInputRecording> InputRecording;
+	double InputRecordingStartSeconds = 0.0;
+	void RecordInputEvent(FManipulatorInputEvent& Event);
+	/** Records the actor selection and captures the starting values of actors the recording hasn't seen yet. */
+	void RecordActorSelection();
+
+	/** Mirror Editing */
+	/** Returns false if the manipulator has no partner. */
+	bool FindMirrorPartner(const FManipulatorHandle& Manipulator, FManipulatorHandle& OutPartner);
+	void BuildMirrorPartners(AActor* Actor, TMap<FName, FName>& OutPairs) const;
+	void QueueMirroredEdit(const FManipulatorHandle& Manipulator, int32 PropertyIndex, const FTransform& VisualTransform, const FTransform& VisualTransformWithDelta, TArray<FManipulatorEdit>& InOutEdits);
+	/** Partner manipulator names per actor, built the first time an actor is mirrored during a drag. */
+	TMap<TWeakObjectPtr<AActor>, TMap<FName, FName>> MirrorPartners;
 };
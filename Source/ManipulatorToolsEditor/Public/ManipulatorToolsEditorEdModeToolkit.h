@@ -4,6 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "Toolkits/BaseToolkit.h"
+#include "Widgets/Input/SComboBox.h"
+
+class UManipulatorPoseLibrary;
+struct FAssetData;
 
 class FManipulatorToolsEditorEdModeToolkit : public FModeToolkit
 {
@@ -26,9 +30,43 @@ public:
 
 	void OnUseSafeDeSelectChanged(ECheckBoxState NewCheckedState);
 	ECheckBoxState UseSafeDeSelect() const;
+
+	void OnUseMirrorEditingChanged(ECheckBoxState NewCheckedState);
+	ECheckBoxState UseMirrorEditing() const;
+
+	FReply OnCopyPoseClicked();
+	FReply OnPastePoseClicked();
+	bool CanPastePose() const;
+
+	FReply OnBakeToSequencerClicked();
+	bool CanBakeToSequencer() const;
+
+	void OnReduceKeysOnReleaseChanged(ECheckBoxState NewCheckedState);
+	ECheckBoxState ReduceKeysOnRelease() const;
+	void OnKeyReductionToleranceChanged(float NewValue);
+	float GetKeyReductionTolerance() const;
+
+	/** Pose Library */
+	FString GetPoseLibraryPath() const;
+	void OnPoseLibraryChanged(const FAssetData& AssetData);
+	void RefreshPoseNames();
+	TSharedRef<SWidget> MakePoseNameWidget(TSharedPtr<FName> PoseName) const;
+	void OnPoseNameSelected(TSharedPtr<FName> PoseName, ESelectInfo::Type SelectInfo);
+	FText GetSelectedPoseNameText() const;
+	void OnNewPoseNameChanged(const FText& InText);
+	FReply OnApplyLibraryPoseClicked();
+	FReply OnSaveLibraryPoseClicked();
+	bool CanApplyLibraryPose() const;
+	bool CanSaveLibraryPose() const;
 	
 	FManipulatorToolsEditorEdMode* GetManipulatorToolsEdMode() const;
 private:
 
 	TSharedPtr<SWidget> ToolkitWidget;
+
+	TWeakObjectPtr<UManipulatorPoseLibrary> PoseLibrary;
+	TArray<TSharedPtr<FName>> PoseNames;
+	TSharedPtr<FName> SelectedPoseName;
+	TSharedPtr<SComboBox<TSharedPtr<FName>>> PoseNameComboBox;
+	FText NewPoseName;
 };
@@ -0,0 +1,24 @@
+// Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ManipulatorValidateCommandlet.generated.h"
+
+/**
+ * Checks the NameToEdit of every manipulator in the project using the manipulator asset registry tags.
+ * Blueprints are only loaded when their tags are missing or stale, or with -Deep to confirm what the tags report as broken.
+ * Usage: -run=ManipulatorValidate [-Deep] [-Path=/Game/Folder]
+ * Returns 0 when no broken bindings were found.
+ */
+UCLASS()
+class UManipulatorValidateCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UManipulatorValidateCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};